@@ -8,12 +8,16 @@
  * How to use:
  * 1. Compile the code: gcc leran.c -o leran
  * 2. Run the executable: ./leran (on Linux/Mac) or leran.exe (on Windows)
+ * 3. (Optional) Measure each level: gcc -DMEASURE_LEVELS leran.c -o leran
+ * 4. (Optional) Report memory use and leaks: gcc -DTRACK_ALLOC leran.c -o leran
  **************************************************************/
 
 // --- Include Essential Libraries ---
 #include <stdio.h> // (Standard Input/Output) for I/O like printf and scanf
 #include <stdlib.h> // (Standard Library) for memory management like malloc and free
 #include <string.h> // (String Library) for handling strings like strlen and strcpy
+#include "perf_counters.h" // (Our own header, "quotes" = look in this folder) for RUN_LEVEL, which can measure each level
+#include "track_alloc.h" // (Our own header) TRACK_MALLOC / TRACK_FREE, which can count every allocation
 
 /* * -----------------------------------------------------------------
  * Level 1: The Bare Essentials
@@ -304,12 +308,14 @@ void level_5_structs_memory() {
     // --- 3. Dynamic Memory Allocation ---
     // Used when we don't know the size of data at compile-time
     // (malloc) - (Memory Allocation) - reserves memory
+    // (We write TRACK_MALLOC and TRACK_FREE: they are exactly malloc and free,
+    // unless you compile with -DTRACK_ALLOC to get a memory report at exit.)
     
     int *dynamicArray;
     int size = 5;
     
     // Reserve memory space for 5 int variables
-    dynamicArray = (int*) malloc(size * sizeof(int));
+    dynamicArray = (int*) TRACK_MALLOC(size * sizeof(int));
     
     if (dynamicArray == NULL) { // Always check if allocation succeeded
         printf("Failed to allocate memory!\n");
@@ -327,11 +333,11 @@ void level_5_structs_memory() {
     printf("\n");
     
     // (free) - (THE MOST IMPORTANT!) - Must release memory when done
-    free(dynamicArray);
+    TRACK_FREE(dynamicArray);
     
     // --- 4. Pointers to Structs ---
     Student_t *s3_ptr;
-    s3_ptr = (Student_t*) malloc(sizeof(Student_t)); // Allocate memory for one struct
+    s3_ptr = (Student_t*) TRACK_MALLOC(sizeof(Student_t)); // Allocate memory for one struct
     
     // We use '->' (the arrow operator) to access members via a pointer
     strcpy(s3_ptr->name, "Ali");
@@ -339,7 +345,7 @@ void level_5_structs_memory() {
     
     printf("Student (s3_ptr): %s, ID: %d\n", s3_ptr->name, s3_ptr->id);
     
-    free(s3_ptr); // Free the struct's memory
+    TRACK_FREE(s3_ptr); // Free the struct's memory
 }
 
 /* * -----------------------------------------------------------------
@@ -491,13 +497,15 @@ int main() {
     printf("===========================================\n");
 
     // Call all levels in order
-    level_1_basics();
-    level_2_control_flow();
-    level_3_functions_pointers();
-    level_4_complex_data();
-    level_5_structs_memory();
-    level_6_advanced_topics();
-    level_7_oop_simulation();
+    // (RUN_LEVEL just calls the function. Compile with -DMEASURE_LEVELS
+    // to also print time and CPU counters for each level.)
+    RUN_LEVEL(level_1_basics());
+    RUN_LEVEL(level_2_control_flow());
+    RUN_LEVEL(level_3_functions_pointers());
+    RUN_LEVEL(level_4_complex_data());
+    RUN_LEVEL(level_5_structs_memory());
+    RUN_LEVEL(level_6_advanced_topics());
+    RUN_LEVEL(level_7_oop_simulation());
 
     printf("\n===========================================\n");
     printf("Reference Guide complete. End of program.\n");
@@ -0,0 +1,2371 @@
+/**************************************************************
+ * Filename: leran_performance.c
+ * Description:
+ * This file is the "Performance Topics" guide for the C language.
+ * It takes the ideas from leran.c and leran_advanced.c (linked
+ * lists, file I/O, bitwise operations, function pointers...) and
+ * shows how to make them fast on large amounts of data.
+ * Every level prints how long its work took, so you can compare
+ * the simple version with the fast one.
+ *
+ * Note: This file uses POSIX functions (mmap, open, ...), so it
+ * runs on Linux and Mac, but not directly on Windows.
+ *
+ * How to use:
+ * 1. Compile: gcc -O2 -pthread leran_performance.c -o leran_perf
+ * 2. Run with the default size:  ./leran_perf
+ * 3. Run with a bigger size:     ./leran_perf 50000000
+ * 4. Report memory use and leaks: add -DTRACK_ALLOC when compiling
+ **************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h> // For malloc, free, strtol, strtod
+#include <string.h> // For memcpy, memcmp
+#include <stddef.h> // For offsetof
+#include <stdint.h> // For fixed-size integers like int32_t and uint64_t
+#include <math.h> // For HUGE_VAL
+#include <fcntl.h> // For open
+#include <unistd.h> // For close, pwrite, sysconf
+#include <sys/mman.h> // For mmap, munmap
+#include <sys/stat.h> // For fstat
+#include <pthread.h> // For pthread_create, pthread_join (Level 16)
+#define PERF_HARDWARE_COUNTERS // Level 15 always reads the hardware counters
+#include "perf_counters.h" // For PerfRegion_t, perf_now_seconds and RUN_LEVEL
+#include "track_alloc.h" // For TRACK_MALLOC / TRACK_REALLOC / TRACK_FREE
+
+// How many elements each level works on.
+// Can be changed from the command line (see main).
+#define DEFAULT_PERF_SIZE 1000000
+static size_t perf_size = DEFAULT_PERF_SIZE;
+
+/* * -----------------------------------------------------------------
+ * The Linked List (same as Level 11 in leran_advanced.c)
+ * -----------------------------------------------------------------
+ */
+typedef struct Node {
+    int data; // The data we are storing
+    struct Node *next; // A pointer to the *next* node in the list
+} Node_t;
+
+Node_t* create_node(int data) {
+    Node_t *newNode = (Node_t*) TRACK_MALLOC(sizeof(Node_t));
+    if (newNode == NULL) {
+        printf("Error: malloc failed in create_node\n");
+        return NULL;
+    }
+    newNode->data = data;
+    newNode->next = NULL;
+    return newNode;
+}
+
+void insert_at_front(Node_t **head, int data) {
+    Node_t *newNode = create_node(data);
+    if (newNode == NULL) {
+        return;
+    }
+    newNode->next = *head;
+    *head = newNode;
+}
+
+// Same as free_list in Level 11, but without the messages
+// (we free millions of nodes here).
+void free_list(Node_t *head) {
+    Node_t *current = head;
+    Node_t *temp;
+
+    while (current != NULL) {
+        temp = current;
+        current = current->next;
+        TRACK_FREE(temp);
+    }
+}
+
+/* * -----------------------------------------------------------------
+ * Level 12: A Persistent Linked List (mmap)
+ * -----------------------------------------------------------------
+ * A Node_t chain lives in RAM and disappears when the program exits.
+ * Saving it as text (Level 6 style) means that the next run has to
+ * read every number back and call malloc once per node.
+ *
+ * Instead, we save the list in a binary file where every 'next'
+ * is stored as an *offset* (a position in the file) instead of an
+ * address. Addresses change from run to run, offsets don't.
+ * Then we map the file into memory with 'mmap': the operating
+ * system makes the file's bytes appear at some address, and we
+ * can follow the offsets directly. No parsing, no malloc.
+ *
+ * File layout:
+ * [ PersistentHeader_t ][ PersistentNode_t ][ PersistentNode_t ] ...
+ *
+ * The header sits at offset 0, so no node can ever be at offset 0.
+ * That is why offset 0 can mean "NULL" (end of the list).
+ * Numbers are stored in this computer's byte order, so a file should
+ * be read back on the same kind of machine that wrote it.
+ */
+
+#define PLIST_MAGIC "LERANLST" // 8 bytes that identify our file format
+
+typedef struct {
+    char magic[8]; // Always PLIST_MAGIC
+    uint64_t count; // Number of nodes in the list
+    uint64_t head; // Offset of the first node (0 = empty list)
+    uint64_t tail; // Offset of the last node (0 = empty list), used by append
+} PersistentHeader_t;
+
+typedef struct {
+    int32_t data; // Same as Node_t.data
+    uint32_t reserved; // Unused: keeps 'next' aligned to 8 bytes
+    uint64_t next; // Offset of the next node (0 = NULL)
+} PersistentNode_t;
+
+// A list opened with plist_open (read-only)
+typedef struct {
+    const unsigned char *base; // Where the file is mapped in memory
+    size_t size; // Size of the mapping in bytes
+    const PersistentHeader_t *header;
+} PersistentList_t;
+
+#define PLIST_WRITE_BATCH 4096 // Nodes written per fwrite call
+
+// Saves a Node_t list to 'path'. Returns 0 on success, -1 on error.
+int plist_save(const char *path, Node_t *head) {
+    FILE *file_ptr = fopen(path, "wb"); // 'b' = binary mode
+    if (file_ptr == NULL) {
+        printf("Error: could not open '%s' for writing\n", path);
+        return -1;
+    }
+
+    // Nodes are written one after another, so node number 'i'
+    // lives at offset sizeof(header) + i * sizeof(node).
+    PersistentHeader_t header;
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, PLIST_MAGIC, sizeof(header.magic));
+    fwrite(&header, sizeof(header), 1, file_ptr); // Rewritten at the end
+
+    PersistentNode_t batch[PLIST_WRITE_BATCH];
+    size_t inBatch = 0;
+    uint64_t count = 0;
+    uint64_t offset = sizeof(PersistentHeader_t);
+
+    for (Node_t *current = head; current != NULL; current = current->next) {
+        PersistentNode_t *node = &batch[inBatch++];
+        node->data = current->data;
+        node->reserved = 0;
+        node->next = (current->next != NULL) ? offset + sizeof(PersistentNode_t) : 0;
+
+        offset += sizeof(PersistentNode_t);
+        count++;
+        if (inBatch == PLIST_WRITE_BATCH) {
+            fwrite(batch, sizeof(PersistentNode_t), inBatch, file_ptr);
+            inBatch = 0;
+        }
+    }
+    fwrite(batch, sizeof(PersistentNode_t), inBatch, file_ptr);
+
+    // Now that we know the count, go back and fill in the header
+    header.count = count;
+    header.head = (count > 0) ? sizeof(PersistentHeader_t) : 0;
+    header.tail = (count > 0) ? offset - sizeof(PersistentNode_t) : 0;
+    fseek(file_ptr, 0, SEEK_SET);
+    fwrite(&header, sizeof(header), 1, file_ptr);
+
+    if (ferror(file_ptr)) {
+        printf("Error: failed while writing '%s'\n", path);
+        fclose(file_ptr);
+        return -1;
+    }
+    return (fclose(file_ptr) == 0) ? 0 : -1;
+}
+
+// 1 if 'offset' is where a whole node could start in a file of
+// 'fileSize' bytes: after the header, on a node boundary, and not
+// running past the end. A damaged file can hold any number here.
+static int plist_offset_valid(uint64_t offset, uint64_t fileSize) {
+    return offset >= sizeof(PersistentHeader_t) &&
+           (offset - sizeof(PersistentHeader_t)) % sizeof(PersistentNode_t) == 0 &&
+           fileSize >= sizeof(PersistentNode_t) &&
+           offset <= fileSize - sizeof(PersistentNode_t);
+}
+
+// Maps a saved list into memory. Returns 0 on success, -1 on error.
+// Nothing is read or converted here: pages are loaded by the OS
+// only when we touch them.
+int plist_open(PersistentList_t *list, const char *path) {
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) {
+        printf("Error: could not open '%s'\n", path);
+        return -1;
+    }
+
+    struct stat info;
+    if (fstat(fd, &info) != 0 || (size_t)info.st_size < sizeof(PersistentHeader_t)) {
+        printf("Error: '%s' is too small to be a list file\n", path);
+        close(fd);
+        return -1;
+    }
+
+    void *mapped = mmap(NULL, (size_t)info.st_size, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd); // The mapping stays valid after the file is closed
+    if (mapped == MAP_FAILED) {
+        printf("Error: mmap failed for '%s'\n", path);
+        return -1;
+    }
+
+    list->base = (const unsigned char*) mapped;
+    list->size = (size_t)info.st_size;
+    list->header = (const PersistentHeader_t*) mapped;
+
+    // Check that this really is our format and that the header is sane
+    const PersistentHeader_t *header = list->header;
+    // Divide instead of multiplying: a huge 'count' would overflow count * size
+    uint64_t maxNodes = (list->size - sizeof(PersistentHeader_t)) / sizeof(PersistentNode_t);
+    if (memcmp(header->magic, PLIST_MAGIC, sizeof(header->magic)) != 0 ||
+        header->count > maxNodes) {
+        printf("Error: '%s' is not a valid list file\n", path);
+        munmap(mapped, list->size);
+        return -1;
+    }
+    return 0;
+}
+
+// Turns an offset into a pointer to the node (NULL for offset 0).
+// Offsets that are not a node in this file (outside it, inside the
+// header, or between two nodes) are treated as the end of the list.
+const PersistentNode_t* plist_node(const PersistentList_t *list, uint64_t offset) {
+    if (offset == 0 || !plist_offset_valid(offset, list->size)) {
+        return NULL;
+    }
+    return (const PersistentNode_t*)(list->base + offset);
+}
+
+const PersistentNode_t* plist_first(const PersistentList_t *list) {
+    return plist_node(list, list->header->head);
+}
+
+// plist_save and plist_append only ever link *forward* in the file, so a
+// 'next' that points back (or at the node itself) means the file is
+// damaged: stop there instead of going around a loop forever.
+const PersistentNode_t* plist_next(const PersistentList_t *list, const PersistentNode_t *node) {
+    uint64_t here = (uint64_t)((const unsigned char*) node - list->base);
+    if (node->next <= here) {
+        return NULL;
+    }
+    return plist_node(list, node->next);
+}
+
+void plist_close(PersistentList_t *list) {
+    munmap((void*) list->base, list->size);
+    list->base = NULL;
+    list->header = NULL;
+    list->size = 0;
+}
+
+// Adds a node at the *end* of a saved list, directly in the file.
+// The new node is written first, then the old tail is linked to it,
+// then the header is updated. An already open PersistentList_t does
+// not see the new node: close it and open it again.
+// Returns 0 on success, -1 on error.
+int plist_append(const char *path, int data) {
+    int fd = open(path, O_RDWR);
+    if (fd < 0) {
+        printf("Error: could not open '%s' for appending\n", path);
+        return -1;
+    }
+
+    PersistentHeader_t header;
+    struct stat info;
+    if (pread(fd, &header, sizeof(header), 0) != (ssize_t)sizeof(header) ||
+        memcmp(header.magic, PLIST_MAGIC, sizeof(header.magic)) != 0 ||
+        fstat(fd, &info) != 0 ||
+        (header.tail != 0 && !plist_offset_valid(header.tail, (uint64_t)info.st_size))) {
+        printf("Error: '%s' is not a valid list file\n", path);
+        close(fd);
+        return -1;
+    }
+
+    // 1. Write the new node at the end of the file
+    PersistentNode_t node;
+    node.data = data;
+    node.reserved = 0;
+    node.next = 0;
+    uint64_t offset = (uint64_t)info.st_size;
+    int ok = pwrite(fd, &node, sizeof(node), (off_t)offset) == (ssize_t)sizeof(node);
+
+    // 2. Link the old tail to it (only its 'next' field changes)
+    if (ok && header.tail != 0) {
+        off_t nextField = (off_t)(header.tail + offsetof(PersistentNode_t, next));
+        ok = pwrite(fd, &offset, sizeof(offset), nextField) == (ssize_t)sizeof(offset);
+    }
+
+    // 3. Update the header
+    if (ok) {
+        if (header.head == 0) {
+            header.head = offset;
+        }
+        header.tail = offset;
+        header.count++;
+        ok = pwrite(fd, &header, sizeof(header), 0) == (ssize_t)sizeof(header);
+    }
+
+    close(fd);
+    if (!ok) {
+        printf("Error: failed while appending to '%s'\n", path);
+        return -1;
+    }
+    return 0;
+}
+
+void level_12_persistent_list() {
+    printf("\n--- Level 12: Persistent Linked List (mmap) ---\n");
+
+    // --- 1. Build a list and save it in both formats ---
+    Node_t *head = NULL;
+    for (size_t i = 0; i < perf_size; i++) {
+        insert_at_front(&head, (int)i);
+    }
+
+    // a. As text, one number per line (like Level 6)
+    FILE *file_ptr = fopen("perf_list.txt", "w");
+    if (file_ptr == NULL) {
+        printf("Could not open file for writing!\n");
+        free_list(head);
+        return;
+    }
+    for (Node_t *current = head; current != NULL; current = current->next) {
+        fprintf(file_ptr, "%d\n", current->data);
+    }
+    fclose(file_ptr);
+
+    // b. As a binary file with offset links
+    if (plist_save("perf_list.bin", head) != 0) {
+        free_list(head);
+        return;
+    }
+    free_list(head);
+    printf("Saved %zu nodes to 'perf_list.txt' and 'perf_list.bin'.\n", perf_size);
+
+    // --- 2. "Startup" by rebuilding from the text file ---
+    // Every line: fgets, convert with atoi, malloc a node.
+    double start = perf_now_seconds();
+    head = NULL;
+    file_ptr = fopen("perf_list.txt", "r");
+    if (file_ptr == NULL) {
+        printf("Could not open file for reading!\n");
+        return;
+    }
+    char lineBuffer[32];
+    while (fgets(lineBuffer, sizeof(lineBuffer), file_ptr) != NULL) {
+        insert_at_front(&head, atoi(lineBuffer));
+    }
+    fclose(file_ptr);
+    long long textSum = 0;
+    for (Node_t *current = head; current != NULL; current = current->next) {
+        textSum += current->data;
+    }
+    double textSeconds = perf_now_seconds() - start;
+    free_list(head);
+
+    // --- 3. "Startup" by mapping the binary file ---
+    // The traversal below is the first time the data is touched.
+    start = perf_now_seconds();
+    PersistentList_t list;
+    if (plist_open(&list, "perf_list.bin") != 0) {
+        return;
+    }
+    long long mappedSum = 0;
+    for (const PersistentNode_t *node = plist_first(&list); node != NULL; node = plist_next(&list, node)) {
+        mappedSum += node->data;
+    }
+    double mappedSeconds = perf_now_seconds() - start;
+    plist_close(&list);
+
+    printf("Rebuild from text + traverse: %.3f s (sum %lld)\n", textSeconds, textSum);
+    printf("mmap open + traverse:         %.3f s (sum %lld)\n", mappedSeconds, mappedSum);
+    if (mappedSeconds > 0) {
+        printf("mmap startup is %.1fx faster.\n", textSeconds / mappedSeconds);
+    }
+
+    // --- 4. Appending to the saved list ---
+    plist_append("perf_list.bin", -1);
+    plist_append("perf_list.bin", -2);
+    if (plist_open(&list, "perf_list.bin") == 0) {
+        const PersistentNode_t *node = plist_node(&list, list.header->tail);
+        if (node != NULL) {
+            printf("After 2 appends: %llu nodes, last value is %d.\n",
+                   (unsigned long long) list.header->count, node->data);
+        } else {
+            printf("Error: the list has no valid last node after appending\n");
+        }
+        plist_close(&list);
+    }
+
+    // Clean up the files we created
+    remove("perf_list.txt");
+    remove("perf_list.bin");
+}
+
+/* * -----------------------------------------------------------------
+ * Level 13: Bulk Number Parsing
+ * -----------------------------------------------------------------
+ * Level 1 reads one number with scanf("%d", &inputAge). That is fine
+ * for one number, but scanf re-reads its format string and locks the
+ * stream for *every* call, so reading millions of numbers is slow.
+ *
+ * The fast way:
+ * 1. Read the file in big blocks (1 MB) with fread.
+ * 2. Walk through the bytes ourselves, using a lookup table to tell
+ *    digits, separators (spaces, newlines, commas) and other bytes apart.
+ * 3. Convert 8 digits at once with "SWAR" (SIMD Within A Register):
+ *    we load 8 characters into one 64-bit integer and combine them
+ *    with a few multiplications and shifts (Level 9 ideas!).
+ *
+ * The parser is strict: "12x", "--3", a number that does not fit in
+ * an int (or a double), or two commas in a row are reported as errors with the
+ * line number and byte offset, instead of being silently skipped.
+ */
+
+#define PARSE_BLOCK_SIZE (1024 * 1024) // Bytes read per fread
+#define PARSE_PADDING 8 // Zero bytes after the data, so 8-byte loads are always safe
+
+// SWAR only works if the first character ends up in the lowest byte
+// of the 64-bit integer, which is true on "little-endian" machines
+// (x86, most ARM). Other machines use the simple digit-by-digit loop.
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+#define PARSE_USE_SWAR 1
+#else
+#define PARSE_USE_SWAR 0
+#endif
+
+enum NumberKind {
+    PARSE_INTS,
+    PARSE_DOUBLES
+};
+
+enum ParseStatus {
+    PARSE_OK,
+    PARSE_BAD_NUMBER, // Not a number, e.g. "12x", "--3" or "1e"
+    PARSE_OUT_OF_RANGE, // Does not fit in an int (or a double)
+    PARSE_EMPTY_FIELD, // A comma with no number before it, e.g. ", 1" or "1,, 2"
+    PARSE_TRAILING_COMMA, // A comma with no number after it, at the end of the input
+    PARSE_TOKEN_TOO_LONG, // One "number" longer than a whole block
+    PARSE_READ_ERROR, // fread failed
+    PARSE_NO_MEMORY // malloc/realloc failed
+};
+
+typedef struct {
+    enum ParseStatus status;
+    size_t line; // Line of the error (the first line is 1)
+    size_t offset; // Byte position of the error from the start of the input
+} ParseError_t;
+
+// The parsed numbers. Only the array for the requested kind is used.
+typedef struct {
+    int *ints;
+    double *doubles;
+    size_t count;
+    size_t capacity;
+} NumberArray_t;
+
+// Everything the parser needs to remember from one block to the next
+typedef struct {
+    enum NumberKind kind;
+    NumberArray_t *out;
+    ParseError_t *error;
+    size_t line; // Current line number
+    size_t blockStart; // Offset of the current block in the whole input
+    int lastWasValue; // 1 if the last thing we saw (spaces aside) was a number
+    int pendingComma; // 1 if a comma is still waiting for the number after it
+    size_t commaLine; // Where that comma is, for the error report
+    size_t commaOffset;
+} BulkParser_t;
+
+// --- 1. Classifying characters with a lookup table ---
+// One table read replaces a chain of comparisons like
+// (c == ' ' || c == '\t' || c == '\n' || ...).
+enum CharClass {
+    CHAR_OTHER = 0, // Anything not listed below
+    CHAR_DIGIT,
+    CHAR_SPACE,
+    CHAR_COMMA
+};
+
+static const unsigned char CHAR_CLASS[256] = {
+    ['0'] = CHAR_DIGIT, ['1'] = CHAR_DIGIT, ['2'] = CHAR_DIGIT, ['3'] = CHAR_DIGIT,
+    ['4'] = CHAR_DIGIT, ['5'] = CHAR_DIGIT, ['6'] = CHAR_DIGIT, ['7'] = CHAR_DIGIT,
+    ['8'] = CHAR_DIGIT, ['9'] = CHAR_DIGIT,
+    [' '] = CHAR_SPACE, ['\t'] = CHAR_SPACE, ['\n'] = CHAR_SPACE,
+    ['\r'] = CHAR_SPACE, ['\v'] = CHAR_SPACE, ['\f'] = CHAR_SPACE,
+    [','] = CHAR_COMMA
+};
+
+#define CLASS_OF(c) (CHAR_CLASS[(unsigned char)(c)])
+#define IS_SEPARATOR(c) (CLASS_OF(c) == CHAR_SPACE || CLASS_OF(c) == CHAR_COMMA)
+
+// --- 2. Reading 8 digits at once (SWAR) ---
+
+// Loads 8 characters into one 64-bit integer.
+// memcpy is the safe way to do this: the address may not be aligned.
+static uint64_t load_eight_chars(const char *p) {
+    uint64_t chunk;
+    memcpy(&chunk, p, sizeof(chunk));
+    return chunk;
+}
+
+// Returns 1 if all 8 bytes are the characters '0' to '9'.
+// Digits are 0x30-0x39: the high half of each byte must be 3, and
+// adding 6 to the byte must *not* carry into the high half (0x3A+ would).
+static int is_eight_digits(uint64_t chunk) {
+    uint64_t highHalves = chunk & 0xF0F0F0F0F0F0F0F0ULL;
+    uint64_t plusSix = (chunk + 0x0606060606060606ULL) & 0xF0F0F0F0F0F0F0F0ULL;
+    return (highHalves | (plusSix >> 4)) == 0x3333333333333333ULL;
+}
+
+// Turns 8 digit characters into their value (0 to 99999999).
+// Each step merges neighbours: 8 digits -> 4 pairs -> 2 quads -> 1 number.
+static uint32_t parse_eight_digits(uint64_t chunk) {
+    chunk -= 0x3030303030303030ULL; // '0'..'9' -> 0..9 in every byte
+    chunk = (chunk * 10 + (chunk >> 8)) & 0x00FF00FF00FF00FFULL; // 4 x (0..99)
+    chunk = (chunk * 100 + (chunk >> 16)) & 0x0000FFFF0000FFFFULL; // 2 x (0..9999)
+    chunk = (chunk * 10000 + (chunk >> 32)) & 0xFFFFFFFFULL; // 1 x (0..99999999)
+    return (uint32_t) chunk;
+}
+
+// Reads a run of digits at *pp into *value and moves *pp past them.
+// Returns how many digits were read. If the value gets too big for
+// uint64_t, *overflow is set to 1 (the digits are still skipped).
+static int read_digits(const char **pp, uint64_t *value, int *overflow) {
+    const char *p = *pp;
+    uint64_t v = *value;
+
+#if PARSE_USE_SWAR
+    // Only while v * 100000000 + 99999999 still fits in uint64_t
+    while (v < 100000000000ULL && is_eight_digits(load_eight_chars(p))) {
+        v = v * 100000000ULL + parse_eight_digits(load_eight_chars(p));
+        p += 8;
+    }
+#endif
+    while (CLASS_OF(*p) == CHAR_DIGIT) {
+        if (v > (UINT64_MAX - 9) / 10) {
+            *overflow = 1;
+        } else {
+            v = v * 10 + (uint64_t)(*p - '0');
+        }
+        p++;
+    }
+
+    int count = (int)(p - *pp);
+    *pp = p;
+    *value = v;
+    return count;
+}
+
+// --- 3. Parsing one number ---
+// 'p' points at the first character of the number. 'end' is where the
+// valid data stops (there are zero bytes after it). Returns a pointer
+// just past the number, or NULL with *status set on error.
+
+static const char* parse_int_token(const char *p, const char *end, int *result, enum ParseStatus *status) {
+    int negative = 0;
+    if (*p == '-' || *p == '+') {
+        negative = (*p == '-');
+        p++;
+    }
+
+    uint64_t value = 0;
+    int overflow = 0;
+    int digits = read_digits(&p, &value, &overflow);
+
+    // A number must have digits and must end at a separator (or at the end)
+    if (digits == 0 || (p != end && !IS_SEPARATOR(*p))) {
+        *status = PARSE_BAD_NUMBER;
+        return NULL;
+    }
+    // The smallest int (-2147483648) is one bigger than the largest (2147483647)
+    if (overflow || value > 2147483647ULL + (uint64_t)negative) {
+        *status = PARSE_OUT_OF_RANGE;
+        return NULL;
+    }
+    *result = negative ? (int)(0u - (unsigned int)value) : (int)value;
+    return p;
+}
+
+// Powers of ten that a double can store *exactly*
+static const double EXACT_POWERS_OF_TEN[] = {
+    1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+    1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+};
+
+static const char* parse_double_token(const char *p, const char *end, double *result, enum ParseStatus *status) {
+    const char *start = p;
+    int negative = 0;
+    if (*p == '-' || *p == '+') {
+        negative = (*p == '-');
+        p++;
+    }
+
+    // Mantissa: "123.456" is read as the integer 123456 with 3 decimals
+    uint64_t mantissa = 0;
+    int overflow = 0;
+    int digits = read_digits(&p, &mantissa, &overflow);
+    int decimals = 0;
+    if (*p == '.') {
+        p++;
+        decimals = read_digits(&p, &mantissa, &overflow);
+        digits += decimals;
+    }
+    if (digits == 0) {
+        *status = PARSE_BAD_NUMBER;
+        return NULL;
+    }
+
+    // Optional exponent: "e5", "E-3", ...
+    long exponent = 0;
+    if (*p == 'e' || *p == 'E') {
+        p++;
+        int negativeExponent = 0;
+        if (*p == '-' || *p == '+') {
+            negativeExponent = (*p == '-');
+            p++;
+        }
+        uint64_t expValue = 0;
+        int expOverflow = 0;
+        if (read_digits(&p, &expValue, &expOverflow) == 0) {
+            *status = PARSE_BAD_NUMBER;
+            return NULL;
+        }
+        if (expOverflow || expValue > 100000) {
+            expValue = 100000; // Far beyond any double: strtod gives 0 or inf
+        }
+        exponent = negativeExponent ? -(long)expValue : (long)expValue;
+    }
+    if (p != end && !IS_SEPARATOR(*p)) {
+        *status = PARSE_BAD_NUMBER;
+        return NULL;
+    }
+
+    // Fast path: if the mantissa fits exactly in a double (at most 2^53)
+    // and the power of ten is exact too, one multiply or divide gives the
+    // correctly rounded result, the same as strtod.
+    long power = exponent - decimals;
+    if (!overflow && mantissa <= (1ULL << 53) && power >= -22 && power <= 22) {
+        double value = (double) mantissa;
+        if (power < 0) {
+            value /= EXACT_POWERS_OF_TEN[-power];
+        } else {
+            value *= EXACT_POWERS_OF_TEN[power];
+        }
+        *result = negative ? -value : value;
+        return p;
+    }
+
+    // Slow path for the rare hard cases. We already checked the syntax,
+    // and the number is followed by a separator or a zero byte, so
+    // strtod stops exactly where we did.
+    double value = strtod(start, NULL);
+    if (value == HUGE_VAL || value == -HUGE_VAL) { // Too big for a double
+        *status = PARSE_OUT_OF_RANGE;
+        return NULL;
+    }
+    *result = value;
+    return p;
+}
+
+// --- 4. Storing the results ---
+
+static int number_array_grow(NumberArray_t *array, enum NumberKind kind) {
+    size_t newCapacity = (array->capacity == 0) ? 1024 : array->capacity * 2;
+    if (kind == PARSE_INTS) {
+        int *bigger = (int*) TRACK_REALLOC(array->ints, newCapacity * sizeof(int));
+        if (bigger == NULL) {
+            return -1;
+        }
+        array->ints = bigger;
+    } else {
+        double *bigger = (double*) TRACK_REALLOC(array->doubles, newCapacity * sizeof(double));
+        if (bigger == NULL) {
+            return -1;
+        }
+        array->doubles = bigger;
+    }
+    array->capacity = newCapacity;
+    return 0;
+}
+
+void number_array_free(NumberArray_t *array) {
+    TRACK_FREE(array->ints);
+    TRACK_FREE(array->doubles);
+    array->ints = NULL;
+    array->doubles = NULL;
+    array->count = 0;
+    array->capacity = 0;
+}
+
+static int parser_fail(BulkParser_t *parser, enum ParseStatus status, size_t offset) {
+    parser->error->status = status;
+    parser->error->line = parser->line;
+    parser->error->offset = offset;
+    return -1;
+}
+
+// --- 5. Parsing one block ---
+// 'data' holds 'length' bytes that end just after a separator
+// (or at the end of the input). Returns 0 on success, -1 on error.
+static int parse_block(BulkParser_t *parser, const char *data, size_t length) {
+    const char *p = data;
+    const char *end = data + length;
+    NumberArray_t *out = parser->out;
+
+    while (p < end) {
+        unsigned char charClass = CLASS_OF(*p);
+
+        if (charClass == CHAR_SPACE) {
+            if (*p == '\n') {
+                parser->line++;
+            }
+            p++;
+            continue;
+        }
+        if (charClass == CHAR_COMMA) {
+            // A comma is only allowed *between* two numbers
+            if (!parser->lastWasValue) {
+                return parser_fail(parser, PARSE_EMPTY_FIELD, parser->blockStart + (size_t)(p - data));
+            }
+            parser->lastWasValue = 0;
+            parser->pendingComma = 1;
+            parser->commaLine = parser->line;
+            parser->commaOffset = parser->blockStart + (size_t)(p - data);
+            p++;
+            continue;
+        }
+
+        // Anything else must be the start of a number
+        if (out->count == out->capacity && number_array_grow(out, parser->kind) != 0) {
+            return parser_fail(parser, PARSE_NO_MEMORY, parser->blockStart + (size_t)(p - data));
+        }
+        enum ParseStatus status = PARSE_OK;
+        const char *next;
+        if (parser->kind == PARSE_INTS) {
+            next = parse_int_token(p, end, &out->ints[out->count], &status);
+        } else {
+            next = parse_double_token(p, end, &out->doubles[out->count], &status);
+        }
+        if (next == NULL) {
+            return parser_fail(parser, status, parser->blockStart + (size_t)(p - data));
+        }
+        out->count++;
+        parser->lastWasValue = 1;
+        parser->pendingComma = 0;
+        p = next;
+    }
+    return 0;
+}
+
+// --- 6. The public function ---
+// Reads every number from 'in' (a file, or stdin) into 'out'.
+// Numbers are separated by spaces, tabs, newlines and/or commas.
+// Returns 0 on success. On error returns -1 and fills 'error'
+// ('out' then holds the numbers read before the error).
+int bulk_parse_numbers(FILE *in, enum NumberKind kind, NumberArray_t *out, ParseError_t *error) {
+    memset(out, 0, sizeof(*out));
+    error->status = PARSE_OK;
+    error->line = 0;
+    error->offset = 0;
+
+    char *buffer = (char*) TRACK_MALLOC(PARSE_BLOCK_SIZE + PARSE_PADDING);
+    if (buffer == NULL) {
+        error->status = PARSE_NO_MEMORY;
+        return -1;
+    }
+
+    BulkParser_t parser = { kind, out, error, 1, 0, 0, 0, 0, 0 };
+    size_t carry = 0; // Bytes of an unfinished number kept from the last block
+    int result = 0;
+
+    for (;;) {
+        size_t wanted = PARSE_BLOCK_SIZE - carry;
+        size_t got = fread(buffer + carry, 1, wanted, in);
+        if (ferror(in)) {
+            result = parser_fail(&parser, PARSE_READ_ERROR, parser.blockStart + carry);
+            break;
+        }
+        size_t length = carry + got;
+        int atEnd = (got < wanted);
+        memset(buffer + length, 0, PARSE_PADDING);
+
+        // A number may be cut in half at the end of the block.
+        // Parse only up to the last separator and keep the rest for later.
+        size_t usable = length;
+        if (!atEnd) {
+            while (usable > 0 && !IS_SEPARATOR(buffer[usable - 1])) {
+                usable--;
+            }
+            if (usable == 0) {
+                result = parser_fail(&parser, PARSE_TOKEN_TOO_LONG, parser.blockStart);
+                break;
+            }
+        }
+
+        if (parse_block(&parser, buffer, usable) != 0) {
+            result = -1;
+            break;
+        }
+
+        carry = length - usable;
+        memmove(buffer, buffer + usable, carry);
+        parser.blockStart += usable;
+        if (atEnd) {
+            break;
+        }
+    }
+
+    // A comma at the very end has no number after it: report where the comma is
+    if (result == 0 && parser.pendingComma) {
+        parser.line = parser.commaLine;
+        result = parser_fail(&parser, PARSE_TRAILING_COMMA, parser.commaOffset);
+    }
+    TRACK_FREE(buffer);
+    return result;
+}
+
+const char* parse_status_message(enum ParseStatus status) {
+    switch (status) {
+        case PARSE_OK: return "no error";
+        case PARSE_BAD_NUMBER: return "not a valid number";
+        case PARSE_OUT_OF_RANGE: return "number out of range";
+        case PARSE_EMPTY_FIELD: return "empty field between commas";
+        case PARSE_TRAILING_COMMA: return "comma with no number after it";
+        case PARSE_TOKEN_TOO_LONG: return "number too long";
+        case PARSE_READ_ERROR: return "read error";
+        case PARSE_NO_MEMORY: return "out of memory";
+    }
+    return "unknown error";
+}
+
+// Reads a whole file into one malloc'ed, '\0'-terminated buffer.
+static char* read_whole_file(const char *path, size_t *length) {
+    FILE *file_ptr = fopen(path, "rb");
+    if (file_ptr == NULL) {
+        return NULL;
+    }
+    fseek(file_ptr, 0, SEEK_END);
+    long size = ftell(file_ptr);
+    fseek(file_ptr, 0, SEEK_SET);
+
+    char *text = (size >= 0) ? (char*) TRACK_MALLOC((size_t)size + 1) : NULL;
+    if (text != NULL) {
+        *length = fread(text, 1, (size_t)size, file_ptr);
+        text[*length] = '\0';
+    }
+    fclose(file_ptr);
+    return text;
+}
+
+void level_13_bulk_parsing() {
+    printf("\n--- Level 13: Bulk Number Parsing ---\n");
+
+    // --- 1. Write a test file of ints (small and large, some negative) ---
+    FILE *file_ptr = fopen("perf_numbers.txt", "w");
+    if (file_ptr == NULL) {
+        printf("Could not open file for writing!\n");
+        return;
+    }
+    srand(13);
+    long long expectedSum = 0;
+    for (size_t i = 0; i < perf_size; i++) {
+        int value = (i % 4 == 0) ? rand() % 100 : rand() - RAND_MAX / 2;
+        expectedSum += value;
+        // 10 numbers per line; the last number also ends its line (no trailing comma)
+        fprintf(file_ptr, (i % 10 == 9 || i + 1 == perf_size) ? "%d\n" : "%d, ", value);
+    }
+    fclose(file_ptr);
+
+    size_t fileBytes = 0;
+    char *text = read_whole_file("perf_numbers.txt", &fileBytes);
+    if (text == NULL) {
+        printf("Could not read 'perf_numbers.txt'!\n");
+        return;
+    }
+    double megabytes = (double) fileBytes / (1024.0 * 1024.0);
+    printf("Test file: %zu ints, %.1f MB.\n", perf_size, megabytes);
+
+    int *values = (int*) TRACK_MALLOC(perf_size * sizeof(int));
+    if (values == NULL) {
+        printf("Failed to allocate memory!\n");
+        TRACK_FREE(text);
+        return;
+    }
+
+    // --- 2. One fscanf call per number (Level 1 style) ---
+    double start = perf_now_seconds();
+    file_ptr = fopen("perf_numbers.txt", "r");
+    if (file_ptr == NULL) {
+        printf("Could not open 'perf_numbers.txt' for reading!\n");
+        TRACK_FREE(text);
+        TRACK_FREE(values);
+        return;
+    }
+    size_t scanfCount = 0;
+    long long scanfSum = 0;
+    // " ," skips spaces and an optional comma after each number
+    while (scanfCount < perf_size && fscanf(file_ptr, "%d ,", &values[scanfCount]) == 1) {
+        scanfSum += values[scanfCount++];
+    }
+    fclose(file_ptr);
+    double scanfSeconds = perf_now_seconds() - start;
+
+    // --- 3. strtol over the file already in memory (read above) ---
+    start = perf_now_seconds();
+    size_t strtolCount = 0;
+    long long strtolSum = 0;
+    char *p = text;
+    while (strtolCount < perf_size) {
+        char *next;
+        long value = strtol(p, &next, 10);
+        if (next == p) {
+            break;
+        }
+        values[strtolCount++] = (int) value;
+        strtolSum += value;
+        p = next;
+        while (*p == ',' || *p == ' ' || *p == '\n') {
+            p++;
+        }
+    }
+    double strtolSeconds = perf_now_seconds() - start;
+    TRACK_FREE(text);
+    TRACK_FREE(values);
+
+    // --- 4. The bulk parser ---
+    start = perf_now_seconds();
+    file_ptr = fopen("perf_numbers.txt", "r");
+    if (file_ptr == NULL) {
+        printf("Could not open 'perf_numbers.txt' for reading!\n");
+        return;
+    }
+    NumberArray_t numbers;
+    ParseError_t error;
+    int status = bulk_parse_numbers(file_ptr, PARSE_INTS, &numbers, &error);
+    fclose(file_ptr);
+    long long bulkSum = 0;
+    for (size_t i = 0; i < numbers.count; i++) {
+        bulkSum += numbers.ints[i];
+    }
+    double bulkSeconds = perf_now_seconds() - start;
+    if (status != 0) {
+        printf("Bulk parser error: %s (line %zu)\n", parse_status_message(error.status), error.line);
+    }
+
+    printf("fscanf:      %8.1f MB/s (%zu ints, sum %lld)\n", megabytes / scanfSeconds, scanfCount, scanfSum);
+    printf("strtol:      %8.1f MB/s (%zu ints, sum %lld)\n", megabytes / strtolSeconds, strtolCount, strtolSum);
+    printf("bulk parser: %8.1f MB/s (%zu ints, sum %lld)\n", megabytes / bulkSeconds, numbers.count, bulkSum);
+    printf("All sums match: %s\n",
+           (scanfSum == expectedSum && strtolSum == expectedSum && bulkSum == expectedSum) ? "yes" : "NO");
+    number_array_free(&numbers);
+
+    // --- 5. Doubles: strtod vs. the bulk parser ---
+    file_ptr = fopen("perf_numbers.txt", "w");
+    if (file_ptr == NULL) {
+        printf("Could not open file for writing!\n");
+        return;
+    }
+    for (size_t i = 0; i < perf_size; i++) {
+        fprintf(file_ptr, "%.3f\n", (rand() - RAND_MAX / 2) / 1000.0);
+    }
+    fclose(file_ptr);
+    text = read_whole_file("perf_numbers.txt", &fileBytes);
+    double *expected = (double*) TRACK_MALLOC(perf_size * sizeof(double));
+    if (text == NULL || expected == NULL) {
+        printf("Failed to allocate memory!\n");
+        TRACK_FREE(text);
+        TRACK_FREE(expected);
+        return;
+    }
+    megabytes = (double) fileBytes / (1024.0 * 1024.0);
+
+    start = perf_now_seconds();
+    p = text;
+    for (size_t i = 0; i < perf_size; i++) {
+        expected[i] = strtod(p, &p);
+    }
+    double strtodSeconds = perf_now_seconds() - start;
+    TRACK_FREE(text);
+
+    start = perf_now_seconds();
+    file_ptr = fopen("perf_numbers.txt", "r");
+    if (file_ptr == NULL) {
+        printf("Could not open 'perf_numbers.txt' for reading!\n");
+        TRACK_FREE(expected);
+        return;
+    }
+    bulk_parse_numbers(file_ptr, PARSE_DOUBLES, &numbers, &error);
+    fclose(file_ptr);
+    bulkSeconds = perf_now_seconds() - start;
+
+    int identical = (numbers.count == perf_size) &&
+                    memcmp(numbers.doubles, expected, perf_size * sizeof(double)) == 0;
+    printf("strtod (doubles):      %8.1f MB/s\n", megabytes / strtodSeconds);
+    printf("bulk parser (doubles): %8.1f MB/s (same bits as strtod: %s)\n",
+           megabytes / bulkSeconds, identical ? "yes" : "NO");
+    number_array_free(&numbers);
+    TRACK_FREE(expected);
+
+    // --- 6. Strict error reporting ---
+    file_ptr = fopen("perf_numbers.txt", "w");
+    if (file_ptr == NULL) {
+        printf("Could not open file for writing!\n");
+        return;
+    }
+    fprintf(file_ptr, "10, 20, 30\n40, 5O, 60\n"); // "5O" uses the letter O
+    fclose(file_ptr);
+    file_ptr = fopen("perf_numbers.txt", "r");
+    if (file_ptr == NULL) {
+        printf("Could not open 'perf_numbers.txt' for reading!\n");
+        remove("perf_numbers.txt");
+        return;
+    }
+    if (bulk_parse_numbers(file_ptr, PARSE_INTS, &numbers, &error) != 0) {
+        printf("Bad input detected: %s at line %zu, byte %zu (after %zu good numbers)\n",
+               parse_status_message(error.status), error.line, error.offset, numbers.count);
+    }
+    fclose(file_ptr);
+    number_array_free(&numbers);
+
+    remove("perf_numbers.txt");
+}
+
+/* * -----------------------------------------------------------------
+ * Level 14: Compact Integer Codecs (Varint, Zig-Zag, Delta, Bit-Packing)
+ * -----------------------------------------------------------------
+ * An int always takes 4 bytes, even when it holds 7. Level 9 showed
+ * the tools to do better: '<<', '>>', '&' and '|' let us store each
+ * number in only as many *bits* as it really needs.
+ *
+ * 1. Varint (LEB128): 7 bits of the number per byte. The top bit of
+ *    each byte says "more bytes follow". 0-127 take 1 byte, and so on.
+ * 2. Zig-zag: maps small negative numbers to small positive ones
+ *    (0, -1, 1, -2, 2 ... -> 0, 1, 2, 3, 4 ...), so -1 doesn't need 32 bits.
+ * 3. Delta: for sorted data (like student IDs) we store the *difference*
+ *    to the previous value instead of the value itself.
+ * 4. Bit-packing: in each block of 128 numbers, find how many bits the
+ *    largest one needs, and store all 128 with exactly that many bits.
+ *
+ * Bit-packed blocks are laid out in 4 "lanes" (number i goes to lane
+ * i % 4), so unpacking does the same shift on 4 numbers side by side.
+ * Written without an 'if' inside and with 'restrict' pointers, that
+ * 4-lane loop becomes SIMD instructions even at -O2.
+ */
+
+#define VARINT_MAX_BYTES 5 // A 32-bit number needs at most 5 varint bytes
+#define BITPACK_BLOCK 128 // Numbers per bit-packed block
+#define BITPACK_LANES 4 // Numbers unpacked side by side
+
+// --- 1. Zig-zag ---
+// (v << 1) makes room for the sign in the lowest bit.
+// The XOR with "all ones" (for negatives) or "all zeros" (for positives)
+// flips the rest so that small negatives stay small.
+static uint32_t zigzag_encode(int32_t value) {
+    uint32_t u = (uint32_t) value;
+    return (u << 1) ^ (0u - (u >> 31));
+}
+
+static int32_t zigzag_decode(uint32_t u) {
+    return (int32_t)((u >> 1) ^ (0u - (u & 1)));
+}
+
+// --- 2. Varint (LEB128) ---
+
+// Encodes 'count' numbers into 'out' (which needs room for
+// count * VARINT_MAX_BYTES bytes). Returns the number of bytes written.
+size_t varint_encode(const uint32_t *in, size_t count, uint8_t *out) {
+    uint8_t *p = out;
+    for (size_t i = 0; i < count; i++) {
+        uint32_t value = in[i];
+        while (value >= 0x80) {
+            *p++ = (uint8_t)(value | 0x80); // Low 7 bits + "more follows" bit
+            value >>= 7;
+        }
+        *p++ = (uint8_t) value; // Last byte: top bit is 0
+    }
+    return (size_t)(p - out);
+}
+
+// Decodes 'count' numbers. Returns the number of bytes read,
+// or 0 if the input is cut short or a number is longer than 5 bytes.
+size_t varint_decode(const uint8_t *in, size_t length, uint32_t *out, size_t count) {
+    const uint8_t *p = in;
+    const uint8_t *end = in + length;
+
+    for (size_t i = 0; i < count; i++) {
+        // Fast path: most numbers in compact data fit in one byte
+        if (p < end && *p < 0x80) {
+            out[i] = *p++;
+            continue;
+        }
+        uint32_t value = 0;
+        int shift = 0;
+        for (;;) {
+            if (p == end || shift >= 7 * VARINT_MAX_BYTES) {
+                return 0;
+            }
+            uint8_t byte = *p++;
+            value |= (uint32_t)(byte & 0x7F) << shift;
+            if (byte < 0x80) {
+                break;
+            }
+            shift += 7;
+        }
+        out[i] = value;
+    }
+    return (size_t)(p - in);
+}
+
+// --- 3. Delta ---
+// Unsigned math: the difference between two ints may not fit in an
+// int, but it wraps around and comes back correctly when decoded.
+
+void delta_encode(const int *in, size_t count, uint32_t *out) {
+    uint32_t previous = 0;
+    for (size_t i = 0; i < count; i++) {
+        uint32_t current = (uint32_t) in[i];
+        out[i] = zigzag_encode((int32_t)(current - previous));
+        previous = current;
+    }
+}
+
+// 'in' and 'out' may be the same array (decoding in place).
+void delta_decode(const uint32_t *in, size_t count, int *out) {
+    uint32_t previous = 0;
+    for (size_t i = 0; i < count; i++) {
+        previous += (uint32_t) zigzag_decode(in[i]);
+        out[i] = (int) previous;
+    }
+}
+
+// --- 4. Bit-packing ---
+// Each block is: 1 word holding 'bits', then BITPACK_BLOCK * bits / 32
+// words of packed data. In lane 'l', word 'w' sits at index w * 4 + l.
+
+// Words needed in the worst case (every number needs all 32 bits)
+size_t bitpack_max_words(size_t count) {
+    size_t blocks = (count + BITPACK_BLOCK - 1) / BITPACK_BLOCK;
+    return blocks * (1 + BITPACK_BLOCK);
+}
+
+// How many bits the largest of these numbers needs (0 to 32)
+static int bits_needed(const uint32_t *in, size_t count) {
+    uint32_t all = 0;
+    for (size_t i = 0; i < count; i++) {
+        all |= in[i]; // The highest bit set in any number survives the OR
+    }
+    int bits = 0;
+    while (bits < 32 && (all >> bits) != 0) {
+        bits++;
+    }
+    return bits;
+}
+
+static void pack_block(const uint32_t *in, uint32_t *out, int bits) {
+    for (int lane = 0; lane < BITPACK_LANES; lane++) {
+        uint32_t word = 0;
+        int used = 0; // Bits already filled in 'word'
+        int w = 0;
+        for (int k = 0; k < BITPACK_BLOCK / BITPACK_LANES; k++) {
+            uint32_t value = in[k * BITPACK_LANES + lane];
+            word |= value << used;
+            used += bits;
+            if (used >= 32) { // Word full: store it, keep the bits that didn't fit
+                out[w * BITPACK_LANES + lane] = word;
+                w++;
+                used -= 32;
+                word = (used > 0) ? value >> (bits - used) : 0;
+            }
+        }
+    }
+}
+
+// Unpacks one block. 'bits' is a constant in each copy made by the macro
+// below, so the compiler knows the mask; 'restrict' promises that 'in'
+// and 'out' don't overlap. The lane loop has no 'if' and the same
+// shifts for all 4 lanes, so the compiler does the 4 lanes at once
+// with SIMD instructions (check with gcc -O2 -fopt-info-vec).
+static inline void unpack_block(const uint32_t *restrict in, uint32_t *restrict out, int bits) {
+    uint32_t mask = (bits == 32) ? 0xFFFFFFFFu : (1u << bits) - 1;
+    for (int k = 0; k < BITPACK_BLOCK / BITPACK_LANES; k++) {
+        int bitPos = k * bits;
+        int w = bitPos / 32;
+        int shift = bitPos % 32;
+        // If the number continues in the next word, 'high' is that word.
+        // If not, 'high' is the same word, and the bits it adds land above
+        // 'bits', where the mask removes them. (Shifting by 1 and then by
+        // 31 - shift avoids a shift by 32, which C does not allow.)
+        int next = (shift + bits > 32) ? w + 1 : w;
+        const uint32_t *restrict low = in + w * BITPACK_LANES;
+        const uint32_t *restrict high = in + next * BITPACK_LANES;
+        uint32_t *restrict dest = out + k * BITPACK_LANES;
+        for (int lane = 0; lane < BITPACK_LANES; lane++) {
+            uint32_t value = (low[lane] >> shift) | ((high[lane] << 1) << (31 - shift));
+            dest[lane] = value & mask;
+        }
+    }
+}
+
+// One specialised copy of unpack_block per bit width (Level 9 macros!)
+#define DEFINE_UNPACK(B) \
+    static void unpack_block_##B(const uint32_t *restrict in, uint32_t *restrict out) { unpack_block(in, out, B); }
+
+static void unpack_block_0(const uint32_t *restrict in, uint32_t *restrict out) {
+    (void) in;
+    memset(out, 0, BITPACK_BLOCK * sizeof(uint32_t)); // 0 bits: every number is 0
+}
+DEFINE_UNPACK(1)  DEFINE_UNPACK(2)  DEFINE_UNPACK(3)  DEFINE_UNPACK(4)
+DEFINE_UNPACK(5)  DEFINE_UNPACK(6)  DEFINE_UNPACK(7)  DEFINE_UNPACK(8)
+DEFINE_UNPACK(9)  DEFINE_UNPACK(10) DEFINE_UNPACK(11) DEFINE_UNPACK(12)
+DEFINE_UNPACK(13) DEFINE_UNPACK(14) DEFINE_UNPACK(15) DEFINE_UNPACK(16)
+DEFINE_UNPACK(17) DEFINE_UNPACK(18) DEFINE_UNPACK(19) DEFINE_UNPACK(20)
+DEFINE_UNPACK(21) DEFINE_UNPACK(22) DEFINE_UNPACK(23) DEFINE_UNPACK(24)
+DEFINE_UNPACK(25) DEFINE_UNPACK(26) DEFINE_UNPACK(27) DEFINE_UNPACK(28)
+DEFINE_UNPACK(29) DEFINE_UNPACK(30) DEFINE_UNPACK(31) DEFINE_UNPACK(32)
+
+// A table of function pointers (Level 6), indexed by bit width
+static void (*const UNPACK_BLOCK[33])(const uint32_t *restrict in, uint32_t *restrict out) = {
+    unpack_block_0,  unpack_block_1,  unpack_block_2,  unpack_block_3,
+    unpack_block_4,  unpack_block_5,  unpack_block_6,  unpack_block_7,
+    unpack_block_8,  unpack_block_9,  unpack_block_10, unpack_block_11,
+    unpack_block_12, unpack_block_13, unpack_block_14, unpack_block_15,
+    unpack_block_16, unpack_block_17, unpack_block_18, unpack_block_19,
+    unpack_block_20, unpack_block_21, unpack_block_22, unpack_block_23,
+    unpack_block_24, unpack_block_25, unpack_block_26, unpack_block_27,
+    unpack_block_28, unpack_block_29, unpack_block_30, unpack_block_31,
+    unpack_block_32
+};
+
+// Packs 'count' numbers into 'out' (bitpack_max_words(count) words).
+// Returns the number of words written.
+size_t bitpack_encode(const uint32_t *in, size_t count, uint32_t *out) {
+    uint32_t *p = out;
+    uint32_t padded[BITPACK_BLOCK];
+
+    for (size_t start = 0; start < count; start += BITPACK_BLOCK) {
+        const uint32_t *block = in + start;
+        size_t inBlock = count - start;
+        if (inBlock < BITPACK_BLOCK) { // Last, partial block: fill up with zeros
+            memset(padded, 0, sizeof(padded));
+            memcpy(padded, block, inBlock * sizeof(uint32_t));
+            block = padded;
+        }
+        int bits = bits_needed(block, BITPACK_BLOCK);
+        *p++ = (uint32_t) bits;
+        pack_block(block, p, bits);
+        p += BITPACK_BLOCK * bits / 32;
+    }
+    return (size_t)(p - out);
+}
+
+// Unpacks 'count' numbers from 'length' words.
+// Returns 0 on success, -1 if the input is damaged or too short.
+int bitpack_decode(const uint32_t *in, size_t length, uint32_t *out, size_t count) {
+    const uint32_t *p = in;
+    const uint32_t *end = in + length;
+    uint32_t padded[BITPACK_BLOCK];
+
+    for (size_t start = 0; start < count; start += BITPACK_BLOCK) {
+        if (p == end || *p > 32) {
+            return -1;
+        }
+        int bits = (int) *p++;
+        size_t words = BITPACK_BLOCK * (size_t) bits / 32;
+        if ((size_t)(end - p) < words) {
+            return -1;
+        }
+        size_t inBlock = count - start;
+        if (inBlock >= BITPACK_BLOCK) {
+            UNPACK_BLOCK[bits](p, out + start);
+        } else {
+            UNPACK_BLOCK[bits](p, padded);
+            memcpy(out + start, padded, inBlock * sizeof(uint32_t));
+        }
+        p += words;
+    }
+    return 0;
+}
+
+// --- 5. Putting the pieces together ---
+enum CodecKind {
+    CODEC_VARINT, // zig-zag + varint
+    CODEC_BITPACK, // zig-zag + bit-packing
+    CODEC_DELTA_BITPACK // delta (with zig-zag) + bit-packing
+};
+
+static size_t codec_encode(enum CodecKind kind, const int *in, size_t count, uint32_t *scratch, void *encoded) {
+    if (kind == CODEC_DELTA_BITPACK) {
+        delta_encode(in, count, scratch);
+    } else {
+        for (size_t i = 0; i < count; i++) {
+            scratch[i] = zigzag_encode(in[i]);
+        }
+    }
+    if (kind == CODEC_VARINT) {
+        return varint_encode(scratch, count, (uint8_t*) encoded);
+    }
+    return bitpack_encode(scratch, count, (uint32_t*) encoded) * sizeof(uint32_t);
+}
+
+static int codec_decode(enum CodecKind kind, const void *encoded, size_t bytes, int *out, size_t count) {
+    uint32_t *raw = (uint32_t*) out; // Decode in place: same size, then convert
+    if (kind == CODEC_VARINT) {
+        if (varint_decode((const uint8_t*) encoded, bytes, raw, count) == 0 && count > 0) {
+            return -1;
+        }
+    } else if (bitpack_decode((const uint32_t*) encoded, bytes / sizeof(uint32_t), raw, count) != 0) {
+        return -1;
+    }
+
+    if (kind == CODEC_DELTA_BITPACK) {
+        delta_decode(raw, count, out);
+    } else {
+        for (size_t i = 0; i < count; i++) {
+            out[i] = zigzag_decode(raw[i]);
+        }
+    }
+    return 0;
+}
+
+// Encodes once, then times the decoder and checks the round trip.
+// Speed is in GB/s of decoded ints (4 bytes each).
+static void benchmark_codec(const char *label, enum CodecKind kind, const int *data, size_t count,
+                            uint32_t *scratch, void *encoded, int *decoded) {
+    size_t bytes = codec_encode(kind, data, count, scratch, encoded);
+
+    // Repeat small inputs so the timing is long enough to be meaningful
+    size_t repeats = (count < 20000000) ? 20000000 / count : 1;
+    int ok = 1;
+    double start = perf_now_seconds();
+    for (size_t r = 0; r < repeats; r++) {
+        if (codec_decode(kind, encoded, bytes, decoded, count) != 0) {
+            ok = 0;
+        }
+    }
+    double seconds = perf_now_seconds() - start;
+    ok = ok && memcmp(decoded, data, count * sizeof(int)) == 0;
+
+    double gigabytes = (double) count * sizeof(int) * (double) repeats / 1e9;
+    printf("  %-26s %6.2f bytes/int (%4.1fx smaller), decode %5.2f GB/s, round trip %s\n",
+           label, (double) bytes / (double) count, (double)(count * sizeof(int)) / (double) bytes,
+           gigabytes / seconds, ok ? "OK" : "FAILED");
+}
+
+void level_14_integer_codecs() {
+    printf("\n--- Level 14: Compact Integer Codecs ---\n");
+
+    // Quick look at what zig-zag and varint do to single numbers
+    printf("zigzag: 0 -> %u, -1 -> %u, 1 -> %u, -2 -> %u\n",
+           zigzag_encode(0), zigzag_encode(-1), zigzag_encode(1), zigzag_encode(-2));
+    uint32_t sample[3] = {5, 300, 70000};
+    uint8_t sampleBytes[3 * VARINT_MAX_BYTES];
+    printf("varint: 5, 300, 70000 take %zu bytes instead of 12\n", varint_encode(sample, 3, sampleBytes));
+
+    size_t count = perf_size;
+    int *ids = (int*) TRACK_MALLOC(count * sizeof(int));
+    int *nodeData = (int*) TRACK_MALLOC(count * sizeof(int));
+    int *decoded = (int*) TRACK_MALLOC(count * sizeof(int));
+    uint32_t *scratch = (uint32_t*) TRACK_MALLOC(count * sizeof(uint32_t));
+    // Big enough for either encoding's worst case
+    size_t encodedBytes = bitpack_max_words(count) * sizeof(uint32_t);
+    if (encodedBytes < count * VARINT_MAX_BYTES) {
+        encodedBytes = count * VARINT_MAX_BYTES;
+    }
+    void *encoded = TRACK_MALLOC(encodedBytes);
+    if (ids == NULL || nodeData == NULL || decoded == NULL || scratch == NULL || encoded == NULL) {
+        printf("Failed to allocate memory!\n");
+        TRACK_FREE(ids); TRACK_FREE(nodeData); TRACK_FREE(decoded); TRACK_FREE(scratch); TRACK_FREE(encoded);
+        return;
+    }
+
+    // Sorted student IDs with small gaps, and small list values around 0
+    srand(14);
+    int id = 100000;
+    for (size_t i = 0; i < count; i++) {
+        id += 1 + rand() % 8;
+        ids[i] = id;
+        nodeData[i] = rand() % 200 - 100;
+    }
+
+    printf("Sorted student IDs (%zu):\n", count);
+    benchmark_codec("zig-zag + varint", CODEC_VARINT, ids, count, scratch, encoded, decoded);
+    benchmark_codec("zig-zag + bit-packing", CODEC_BITPACK, ids, count, scratch, encoded, decoded);
+    benchmark_codec("delta + bit-packing", CODEC_DELTA_BITPACK, ids, count, scratch, encoded, decoded);
+
+    printf("Small Node_t data values (%zu):\n", count);
+    benchmark_codec("zig-zag + varint", CODEC_VARINT, nodeData, count, scratch, encoded, decoded);
+    benchmark_codec("zig-zag + bit-packing", CODEC_BITPACK, nodeData, count, scratch, encoded, decoded);
+    benchmark_codec("delta + bit-packing", CODEC_DELTA_BITPACK, nodeData, count, scratch, encoded, decoded);
+
+    TRACK_FREE(ids);
+    TRACK_FREE(nodeData);
+    TRACK_FREE(decoded);
+    TRACK_FREE(scratch);
+    TRACK_FREE(encoded);
+}
+
+/* * -----------------------------------------------------------------
+ * Level 15: Hardware Counters (Why Is It Slow?)
+ * -----------------------------------------------------------------
+ * Here we add up the same numbers three times: from an array, from a
+ * linked list whose nodes sit one after another in memory, and from
+ * a linked list whose nodes are visited in random order.
+ * The time alone says the last one is slow. The counters from
+ * perf_counters.h say why: almost every node is a cache miss, so the
+ * CPU spends its cycles waiting for memory (low IPC).
+ * Try it with a bigger size: the gap grows once the list no longer
+ * fits in the CPU's caches.
+ */
+void level_15_hardware_counters() {
+    printf("\n--- Level 15: Hardware Counters (Why Is It Slow?) ---\n");
+
+    size_t count = perf_size;
+    int *array = (int*) TRACK_MALLOC(count * sizeof(int));
+    Node_t *nodes = (Node_t*) TRACK_MALLOC(count * sizeof(Node_t)); // All nodes in one block
+    size_t *order = (size_t*) TRACK_MALLOC(count * sizeof(size_t));
+    if (array == NULL || nodes == NULL || order == NULL) {
+        printf("Failed to allocate memory!\n");
+        TRACK_FREE(array);
+        TRACK_FREE(nodes);
+        TRACK_FREE(order);
+        return;
+    }
+
+    srand(15);
+    for (size_t i = 0; i < count; i++) {
+        array[i] = rand() % 1000;
+        order[i] = i;
+    }
+
+    // Shuffle the visiting order (Fisher-Yates). Two rand() calls,
+    // because RAND_MAX may be as small as 32767.
+    for (size_t i = count - 1; i > 0; i--) {
+        size_t j = (((size_t) rand() << 15) ^ (size_t) rand()) % (i + 1);
+        size_t temp = order[i];
+        order[i] = order[j];
+        order[j] = temp;
+    }
+
+    PerfRegion_t region;
+    long long arraySum = 0;
+    perf_region_begin(&region, "array");
+    for (size_t i = 0; i < count; i++) {
+        arraySum += array[i];
+    }
+    perf_region_end(&region);
+    perf_region_report(&region, count);
+
+    // Linked list, nodes in memory order: node i -> node i + 1
+    for (size_t i = 0; i < count; i++) {
+        nodes[i].data = array[i];
+        nodes[i].next = (i + 1 < count) ? &nodes[i + 1] : NULL;
+    }
+    long long sequentialSum = 0;
+    perf_region_begin(&region, "linked list, sequential nodes");
+    for (Node_t *current = &nodes[0]; current != NULL; current = current->next) {
+        sequentialSum += current->data;
+    }
+    perf_region_end(&region);
+    perf_region_report(&region, count);
+
+    // Same values, but each node links to a random other node
+    for (size_t i = 0; i < count; i++) {
+        Node_t *node = &nodes[order[i]];
+        node->data = array[i];
+        node->next = (i + 1 < count) ? &nodes[order[i + 1]] : NULL;
+    }
+    long long shuffledSum = 0;
+    perf_region_begin(&region, "linked list, shuffled nodes");
+    for (Node_t *current = &nodes[order[0]]; current != NULL; current = current->next) {
+        shuffledSum += current->data;
+    }
+    perf_region_end(&region);
+    perf_region_report(&region, count);
+
+    printf("Sums (all equal): %lld %lld %lld\n", arraySum, sequentialSum, shuffledSum);
+
+    TRACK_FREE(array);
+    TRACK_FREE(nodes);
+    TRACK_FREE(order);
+}
+
+/* * -----------------------------------------------------------------
+ * Level 16: Scanning a Big File with Several Threads
+ * -----------------------------------------------------------------
+ * Level 6 reads 'test.txt' line by line with fgets, on one thread.
+ * For a file of several GB, the other CPU cores just sit idle.
+ *
+ * Here the file is mapped into memory (like Level 12) and cut into
+ * N byte ranges, one per thread. A cut can land in the middle of a
+ * line, so each cut is moved forward to just after the next '\n'.
+ * Every line then belongs to exactly one range.
+ *
+ * What to do with each line is passed in as a function pointer, just
+ * like 'calcPtr' in Level 6. Each thread fills in its *own* result, and
+ * a second function pointer merges them when all threads are done,
+ * so the threads never have to wait for each other.
+ */
+
+#define SCAN_MAX_THREADS 64
+#define CACHE_LINE_SIZE 64 // Bytes the CPU moves between cores at a time
+
+// Called once per line (without the '\n'), with the thread's own state
+typedef void (*LineCallback_t)(const char *line, size_t length, void *state);
+// Adds the result of one thread ('from') to the final result ('into')
+typedef void (*MergeCallback_t)(void *into, const void *from);
+
+typedef struct {
+    LineCallback_t onLine;
+    MergeCallback_t merge;
+    size_t stateSize; // Size of the per-thread state / result
+} LineScanner_t;
+
+// Everything one thread needs
+typedef struct {
+    const char *start;
+    const char *end;
+    const LineScanner_t *scanner;
+    void *state;
+} ScanChunk_t;
+
+static void* scan_chunk(void *arg) {
+    ScanChunk_t *chunk = (ScanChunk_t*) arg;
+    LineCallback_t onLine = chunk->scanner->onLine;
+    const char *p = chunk->start;
+
+    while (p < chunk->end) {
+        // memchr finds the next '\n' much faster than a byte-by-byte loop
+        const char *newline = (const char*) memchr(p, '\n', (size_t)(chunk->end - p));
+        const char *lineEnd = (newline != NULL) ? newline : chunk->end; // Last line may have no '\n'
+        onLine(p, (size_t)(lineEnd - p), chunk->state);
+        p = lineEnd + 1;
+    }
+    return NULL;
+}
+
+// Scans 'path' with 'threadCount' threads. 'result' must point to a
+// zeroed state of scanner->stateSize bytes; the merged result goes there.
+// Returns 0 on success, -1 on error.
+int scan_file_parallel(const char *path, int threadCount, const LineScanner_t *scanner, void *result) {
+    if (threadCount < 1) {
+        threadCount = 1;
+    }
+    if (threadCount > SCAN_MAX_THREADS) {
+        threadCount = SCAN_MAX_THREADS;
+    }
+
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) {
+        printf("Error: could not open '%s'\n", path);
+        return -1;
+    }
+    struct stat info;
+    if (fstat(fd, &info) != 0) {
+        close(fd);
+        return -1;
+    }
+    size_t size = (size_t) info.st_size;
+    if (size == 0) { // Nothing to scan (and mmap refuses 0 bytes)
+        close(fd);
+        return 0;
+    }
+    void *mapped = mmap(NULL, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (mapped == MAP_FAILED) {
+        printf("Error: mmap failed for '%s'\n", path);
+        return -1;
+    }
+    const char *text = (const char*) mapped;
+
+    // Each thread's state gets its own cache line(s). If two threads
+    // wrote to counters in the same cache line, the cores would keep
+    // stealing that line from each other ("false sharing").
+    size_t stride = (scanner->stateSize + CACHE_LINE_SIZE - 1) / CACHE_LINE_SIZE * CACHE_LINE_SIZE;
+    char *states = (char*) TRACK_MALLOC(stride * (size_t) threadCount + CACHE_LINE_SIZE);
+    if (states == NULL) {
+        munmap(mapped, size);
+        return -1;
+    }
+    // Start the first state on a cache line boundary
+    char *firstState = states + (CACHE_LINE_SIZE - (size_t) states % CACHE_LINE_SIZE) % CACHE_LINE_SIZE;
+    memset(firstState, 0, stride * (size_t) threadCount);
+
+    // Cut the file into ranges that start right after a '\n'
+    ScanChunk_t chunks[SCAN_MAX_THREADS];
+    pthread_t threads[SCAN_MAX_THREADS];
+    int started[SCAN_MAX_THREADS];
+    size_t previousEnd = 0;
+    for (int i = 0; i < threadCount; i++) {
+        size_t end = size;
+        if (i < threadCount - 1) {
+            end = size / (size_t) threadCount * (size_t)(i + 1);
+            if (end < previousEnd) {
+                end = previousEnd;
+            }
+            const char *newline = (const char*) memchr(text + end, '\n', size - end);
+            end = (newline != NULL) ? (size_t)(newline - text) + 1 : size;
+        }
+        chunks[i].start = text + previousEnd;
+        chunks[i].end = text + end;
+        chunks[i].scanner = scanner;
+        chunks[i].state = firstState + stride * (size_t) i;
+        previousEnd = end;
+    }
+
+    // Start the threads. If one can't be started, do its work right here.
+    for (int i = 0; i < threadCount; i++) {
+        started[i] = (pthread_create(&threads[i], NULL, scan_chunk, &chunks[i]) == 0);
+        if (!started[i]) {
+            scan_chunk(&chunks[i]);
+        }
+    }
+    // Wait for all threads, then merge their results in order
+    for (int i = 0; i < threadCount; i++) {
+        if (started[i]) {
+            pthread_join(threads[i], NULL);
+        }
+        scanner->merge(result, chunks[i].state);
+    }
+
+    TRACK_FREE(states);
+    munmap(mapped, size);
+    return 0;
+}
+
+// --- Example callbacks: counting lines, words and numbers ---
+
+typedef struct {
+    size_t lines;
+    size_t words; // Runs of characters between spaces/tabs
+    size_t numbers; // Words that are whole numbers, like "42" or "-7"
+} TextStats_t;
+
+void count_text_stats(const char *line, size_t length, void *state) {
+    TextStats_t *stats = (TextStats_t*) state;
+    stats->lines++;
+
+    size_t i = 0;
+    while (i < length) {
+        while (i < length && (line[i] == ' ' || line[i] == '\t' || line[i] == '\r')) {
+            i++; // Skip spaces before the word
+        }
+        if (i == length) {
+            break;
+        }
+        size_t wordStart = i;
+        while (i < length && line[i] != ' ' && line[i] != '\t' && line[i] != '\r') {
+            i++; // Move to the end of the word
+        }
+        stats->words++;
+
+        // A number is an optional '-' followed by one or more digits
+        size_t d = (line[wordStart] == '-') ? wordStart + 1 : wordStart;
+        int isNumber = (d < i);
+        for (; d < i && isNumber; d++) {
+            isNumber = (line[d] >= '0' && line[d] <= '9');
+        }
+        if (isNumber) {
+            stats->numbers++;
+        }
+    }
+}
+
+void merge_text_stats(void *into, const void *from) {
+    TextStats_t *total = (TextStats_t*) into;
+    const TextStats_t *part = (const TextStats_t*) from;
+    total->lines += part->lines;
+    total->words += part->words;
+    total->numbers += part->numbers;
+}
+
+void level_16_parallel_scan() {
+    printf("\n--- Level 16: Scanning a Big File with Several Threads ---\n");
+
+    // --- 1. Write a test file ---
+    FILE *file_ptr = fopen("perf_text.txt", "w");
+    if (file_ptr == NULL) {
+        printf("Could not open file for writing!\n");
+        return;
+    }
+    static const char *names[] = { "Ahmed", "Fatima", "Ali", "Sara", "Youssef" };
+    srand(16);
+    for (size_t i = 0; i < perf_size; i++) {
+        fprintf(file_ptr, "Student %s has ID %d and grade %d in test -%d\n",
+                names[rand() % 5], 100 + rand() % 9000, rand() % 101, 1 + rand() % 9);
+    }
+    fclose(file_ptr);
+
+    // --- 2. One thread, Level 6 style (fgets) ---
+    double start = perf_now_seconds();
+    TextStats_t fgetsStats = { 0, 0, 0 };
+    file_ptr = fopen("perf_text.txt", "r");
+    if (file_ptr == NULL) {
+        printf("Could not open 'perf_text.txt' for reading!\n");
+        remove("perf_text.txt");
+        return;
+    }
+    char lineBuffer[256];
+    while (fgets(lineBuffer, sizeof(lineBuffer), file_ptr) != NULL) {
+        size_t length = strlen(lineBuffer);
+        if (length > 0 && lineBuffer[length - 1] == '\n') {
+            length--;
+        }
+        count_text_stats(lineBuffer, length, &fgetsStats);
+    }
+    fclose(file_ptr);
+    double fgetsSeconds = perf_now_seconds() - start;
+    printf("fgets, 1 thread:    %.3f s (%zu lines, %zu words, %zu numbers)\n",
+           fgetsSeconds, fgetsStats.lines, fgetsStats.words, fgetsStats.numbers);
+
+    // --- 3. The parallel scanner with 1, 2, 4, ... threads ---
+    // Like 'calcPtr' in Level 6: the scanner only knows "a function to call"
+    LineScanner_t scanner;
+    scanner.onLine = &count_text_stats;
+    scanner.merge = &merge_text_stats;
+    scanner.stateSize = sizeof(TextStats_t);
+
+    long cores = sysconf(_SC_NPROCESSORS_ONLN);
+    if (cores < 1) {
+        cores = 1;
+    }
+    printf("This machine has %ld core(s).\n", cores);
+
+    double oneThreadSeconds = 0;
+    for (int threads = 1; threads <= cores * 2 && threads <= SCAN_MAX_THREADS; threads *= 2) {
+        TextStats_t stats = { 0, 0, 0 };
+        start = perf_now_seconds();
+        if (scan_file_parallel("perf_text.txt", threads, &scanner, &stats) != 0) {
+            break;
+        }
+        double seconds = perf_now_seconds() - start;
+        if (threads == 1) {
+            oneThreadSeconds = seconds;
+        }
+        int same = stats.lines == fgetsStats.lines && stats.words == fgetsStats.words &&
+                   stats.numbers == fgetsStats.numbers;
+        printf("mmap, %2d thread(s): %.3f s (speedup %.2fx, results %s)\n",
+               threads, seconds, oneThreadSeconds / seconds, same ? "match" : "DIFFER");
+    }
+
+    remove("perf_text.txt");
+}
+
+/* * -----------------------------------------------------------------
+ * Level 17: Batch Operations Without Function Pointer Calls
+ * -----------------------------------------------------------------
+ * Level 6 calls 'calcPtr(50, 30)' for one pair of numbers. To add two
+ * big arrays through a function pointer, we would call it once per
+ * element. The compiler cannot see *which* function it will be, so it
+ * cannot inline it or use SIMD instructions (that add 4-8 ints at once).
+ *
+ * The fix: batch_zip checks whether the pointer is one of the
+ * operations it knows (add, subtract, multiply, min, max). If so, it
+ * runs a loop written especially for that operation, which the compiler
+ * turns into SIMD code. Any other function still works, through the
+ * simple "call the pointer for every element" loop.
+ */
+
+// The operation type: same shape as 'calcPtr' in Level 6
+typedef int (*BinaryOp_t)(int, int);
+
+// The known operations (addNumbers is the same as in Level 3)
+int addNumbers(int num1, int num2) { return num1 + num2; }
+int subtractNumbers(int num1, int num2) { return num1 - num2; }
+int multiplyNumbers(int num1, int num2) { return num1 * num2; }
+int minNumbers(int num1, int num2) { return (num1 < num2) ? num1 : num2; }
+int maxNumbers(int num1, int num2) { return (num1 > num2) ? num1 : num2; }
+
+// An operation batch_zip doesn't know: it uses the fallback loop
+int averageNumbers(int num1, int num2) { return (num1 + num2) / 2; }
+
+// --- 1. The generic loops (one function pointer call per element) ---
+
+// out[i] = op(a[i], b[i])
+void batch_zip_generic(const int *a, const int *b, int *out, size_t count, BinaryOp_t op) {
+    for (size_t i = 0; i < count; i++) {
+        out[i] = op(a[i], b[i]);
+    }
+}
+
+// out[i] = op(a[i], value)
+void batch_map_generic(const int *a, int value, int *out, size_t count, BinaryOp_t op) {
+    for (size_t i = 0; i < count; i++) {
+        out[i] = op(a[i], value);
+    }
+}
+
+// --- 2. One specialised loop per known operation (Level 9 macros) ---
+// EXPR uses 'x' (from a) and 'y' (from b, or the single value).
+// Because EXPR is pasted right into the loop, there is no call at all.
+// Two more details help the compiler produce SIMD code:
+// - 'restrict' promises that 'out' does not overlap 'a' or 'b', so
+//   writing out[i] can never change a value we still have to read.
+// - The main loop handles BATCH_WIDTH elements per step (a fixed
+//   count, so all of them can go into vector registers). A short
+//   loop at the end handles the last few elements.
+#define BATCH_WIDTH 8
+
+#define DEFINE_BATCH_OP(NAME, EXPR) \
+    static void batch_zip_##NAME(const int *restrict a, const int *restrict b, int *restrict out, size_t count) { \
+        size_t i = 0; \
+        for (; i + BATCH_WIDTH <= count; i += BATCH_WIDTH) { \
+            for (size_t j = 0; j < BATCH_WIDTH; j++) { \
+                int x = a[i + j]; \
+                int y = b[i + j]; \
+                out[i + j] = (EXPR); \
+            } \
+        } \
+        for (; i < count; i++) { \
+            int x = a[i]; \
+            int y = b[i]; \
+            out[i] = (EXPR); \
+        } \
+    } \
+    static void batch_map_##NAME(const int *restrict a, int value, int *restrict out, size_t count) { \
+        size_t i = 0; \
+        for (; i + BATCH_WIDTH <= count; i += BATCH_WIDTH) { \
+            for (size_t j = 0; j < BATCH_WIDTH; j++) { \
+                int x = a[i + j]; \
+                int y = value; \
+                out[i + j] = (EXPR); \
+            } \
+        } \
+        for (; i < count; i++) { \
+            int x = a[i]; \
+            int y = value; \
+            out[i] = (EXPR); \
+        } \
+    }
+
+DEFINE_BATCH_OP(add, x + y)
+DEFINE_BATCH_OP(subtract, x - y)
+DEFINE_BATCH_OP(multiply, x * y)
+DEFINE_BATCH_OP(min, (x < y) ? x : y)
+DEFINE_BATCH_OP(max, (x > y) ? x : y)
+
+// --- 3. The public functions: pick the specialised loop if we can ---
+// Comparing function pointers is allowed: &addNumbers is always the
+// same address. If 'out' overlaps an input (for example, doing it
+// "in place" with out == a), the 'restrict' promise would be broken,
+// so we use the generic loop, which is always correct.
+
+static int arrays_overlap(const int *x, const int *y, size_t count) {
+    uintptr_t startX = (uintptr_t) x;
+    uintptr_t startY = (uintptr_t) y;
+    uintptr_t bytes = (uintptr_t)(count * sizeof(int));
+    return startX < startY + bytes && startY < startX + bytes;
+}
+
+void batch_zip(const int *a, const int *b, int *out, size_t count, BinaryOp_t op) {
+    if (arrays_overlap(a, out, count) || arrays_overlap(b, out, count)) {
+        batch_zip_generic(a, b, out, count, op);
+    } else if (op == &addNumbers) {
+        batch_zip_add(a, b, out, count);
+    } else if (op == &subtractNumbers) {
+        batch_zip_subtract(a, b, out, count);
+    } else if (op == &multiplyNumbers) {
+        batch_zip_multiply(a, b, out, count);
+    } else if (op == &minNumbers) {
+        batch_zip_min(a, b, out, count);
+    } else if (op == &maxNumbers) {
+        batch_zip_max(a, b, out, count);
+    } else {
+        batch_zip_generic(a, b, out, count, op);
+    }
+}
+
+void batch_map(const int *a, int value, int *out, size_t count, BinaryOp_t op) {
+    if (arrays_overlap(a, out, count)) {
+        batch_map_generic(a, value, out, count, op);
+    } else if (op == &addNumbers) {
+        batch_map_add(a, value, out, count);
+    } else if (op == &subtractNumbers) {
+        batch_map_subtract(a, value, out, count);
+    } else if (op == &multiplyNumbers) {
+        batch_map_multiply(a, value, out, count);
+    } else if (op == &minNumbers) {
+        batch_map_min(a, value, out, count);
+    } else if (op == &maxNumbers) {
+        batch_map_max(a, value, out, count);
+    } else {
+        batch_map_generic(a, value, out, count, op);
+    }
+}
+
+void level_17_batch_operations() {
+    printf("\n--- Level 17: Batch Operations Without Function Pointer Calls ---\n");
+
+    size_t count = perf_size;
+    int *a = (int*) TRACK_MALLOC(count * sizeof(int));
+    int *b = (int*) TRACK_MALLOC(count * sizeof(int));
+    int *generic = (int*) TRACK_MALLOC(count * sizeof(int));
+    int *fast = (int*) TRACK_MALLOC(count * sizeof(int));
+    if (a == NULL || b == NULL || generic == NULL || fast == NULL) {
+        printf("Failed to allocate memory!\n");
+        TRACK_FREE(a);
+        TRACK_FREE(b);
+        TRACK_FREE(generic);
+        TRACK_FREE(fast);
+        return;
+    }
+
+    // Small values, so add and multiply never overflow
+    srand(17);
+    for (size_t i = 0; i < count; i++) {
+        a[i] = rand() % 20001 - 10000;
+        b[i] = rand() % 20001 - 10000;
+    }
+
+    // One call through a pointer, exactly like Level 6
+    int (*calcPtr)(int, int) = &addNumbers;
+    printf("calcPtr(50, 30) = %d\n", calcPtr(50, 30));
+
+    static const struct {
+        const char *name;
+        BinaryOp_t op;
+    } operations[] = {
+        { "add", &addNumbers },
+        { "subtract", &subtractNumbers },
+        { "multiply", &multiplyNumbers },
+        { "min", &minNumbers },
+        { "max", &maxNumbers },
+        { "average (fallback)", &averageNumbers }
+    };
+
+    // Repeat small inputs so the timing is long enough to be meaningful
+    size_t repeats = (count < 50000000) ? 50000000 / count : 1;
+
+    for (size_t k = 0; k < sizeof(operations) / sizeof(operations[0]); k++) {
+        // Reading the pointer through 'volatile' hides its value from the
+        // compiler, so the generic loop really calls through the pointer
+        // (otherwise the compiler might specialise it by itself).
+        BinaryOp_t volatile hiddenOp = operations[k].op;
+
+        double start = perf_now_seconds();
+        for (size_t r = 0; r < repeats; r++) {
+            batch_zip_generic(a, b, generic, count, hiddenOp);
+        }
+        double genericSeconds = perf_now_seconds() - start;
+
+        start = perf_now_seconds();
+        for (size_t r = 0; r < repeats; r++) {
+            batch_zip(a, b, fast, count, hiddenOp);
+        }
+        double fastSeconds = perf_now_seconds() - start;
+
+        int same = memcmp(generic, fast, count * sizeof(int)) == 0;
+        double elements = (double) count * (double) repeats;
+        printf("  zip %-18s pointer per element %5.2f ns, batch %5.2f ns (%4.1fx), results %s\n",
+               operations[k].name, genericSeconds * 1e9 / elements, fastSeconds * 1e9 / elements,
+               genericSeconds / fastSeconds, same ? "match" : "DIFFER");
+    }
+
+    // batch_map: one array and a single value, e.g. "add 5 to every grade"
+    BinaryOp_t volatile hiddenAdd = &addNumbers;
+    double start = perf_now_seconds();
+    for (size_t r = 0; r < repeats; r++) {
+        batch_map_generic(a, 5, generic, count, hiddenAdd);
+    }
+    double genericSeconds = perf_now_seconds() - start;
+    start = perf_now_seconds();
+    for (size_t r = 0; r < repeats; r++) {
+        batch_map(a, 5, fast, count, hiddenAdd);
+    }
+    double fastSeconds = perf_now_seconds() - start;
+    double elements = (double) count * (double) repeats;
+    printf("  map %-18s pointer per element %5.2f ns, batch %5.2f ns (%4.1fx), results %s\n",
+           "add 5", genericSeconds * 1e9 / elements, fastSeconds * 1e9 / elements, genericSeconds / fastSeconds,
+           memcmp(generic, fast, count * sizeof(int)) == 0 ? "match" : "DIFFER");
+
+    TRACK_FREE(a);
+    TRACK_FREE(b);
+    TRACK_FREE(generic);
+    TRACK_FREE(fast);
+}
+
+/* * -----------------------------------------------------------------
+ * Level 18: Interned Strings (A String Pool)
+ * -----------------------------------------------------------------
+ * 'struct Student' (Level 5) and 'Car' (Level 7) each hold a
+ * 'char name[50]' / 'char model[50]'. A name like "Ali" uses 4 of
+ * those bytes, and 1000 students named "Ali" store it 1000 times.
+ * Comparing two names also needs strcmp, which walks the characters.
+ *
+ * "Interning" keeps *one* copy of every different string in a pool
+ * and gives each one a number (a "handle"). A record stores the 4-byte
+ * handle instead of the 50-byte array, and two names are equal
+ * exactly when their handles are equal: one int comparison.
+ *
+ * The pool has two parts:
+ * - An arena: big blocks of memory where the characters are copied
+ *   one after another (one malloc per block, not per string).
+ * - A hash table, to find out quickly whether a string is already in
+ *   the pool (so the same text always gets the same handle).
+ */
+
+// The records from Level 5 and Level 7, as they are in leran.c
+struct Student {
+    char name[50];
+    int id;
+    float gpa;
+};
+
+typedef struct Car_t {
+    char model[50];
+    int year;
+    int speed;
+    void (*printDetails)(struct Car_t *self);
+    void (*accelerate)(struct Car_t *self, int amount);
+} Car;
+
+typedef uint32_t StringHandle_t; // 0 means "no string"
+
+#define POOL_BLOCK_SIZE (64 * 1024) // Bytes per arena block
+
+typedef struct PoolBlock {
+    struct PoolBlock *next; // Blocks form a linked list, for freeing
+    size_t used;
+    size_t capacity;
+    char data[]; // The characters ("flexible array member", sized by malloc)
+} PoolBlock_t;
+
+typedef struct {
+    PoolBlock_t *blocks; // The current block is the first one
+    // Per handle (index 0 is unused, so that 0 can mean "none")
+    const char **strings;
+    uint32_t *hashes; // Kept so the table can grow without rehashing text
+    uint32_t count; // Handles given out so far, plus the unused 0
+    uint32_t capacity;
+    // Hash table: each slot holds a handle, 0 = empty slot
+    StringHandle_t *slots;
+    uint32_t slotCount; // Always a power of two
+} StringPool_t;
+
+// FNV-1a: a simple, decent hash for short strings
+static uint32_t hash_string(const char *text, size_t length) {
+    uint32_t hash = 2166136261u;
+    for (size_t i = 0; i < length; i++) {
+        hash ^= (unsigned char) text[i];
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+// Returns 0 on success, -1 if memory could not be allocated.
+int string_pool_init(StringPool_t *pool) {
+    memset(pool, 0, sizeof(*pool));
+    pool->capacity = 1024;
+    pool->slotCount = 2048;
+    pool->strings = (const char**) TRACK_MALLOC(pool->capacity * sizeof(const char*));
+    pool->hashes = (uint32_t*) TRACK_MALLOC(pool->capacity * sizeof(uint32_t));
+    pool->slots = (StringHandle_t*) TRACK_CALLOC(pool->slotCount, sizeof(StringHandle_t));
+    if (pool->strings == NULL || pool->hashes == NULL || pool->slots == NULL) {
+        TRACK_FREE(pool->strings);
+        TRACK_FREE(pool->hashes);
+        TRACK_FREE(pool->slots);
+        memset(pool, 0, sizeof(*pool));
+        return -1;
+    }
+    pool->strings[0] = ""; // Handle 0 reads as an empty string
+    pool->hashes[0] = 0;
+    pool->count = 1;
+    return 0;
+}
+
+void string_pool_free(StringPool_t *pool) {
+    PoolBlock_t *block = pool->blocks;
+    while (block != NULL) {
+        PoolBlock_t *next = block->next;
+        TRACK_FREE(block);
+        block = next;
+    }
+    TRACK_FREE(pool->strings);
+    TRACK_FREE(pool->hashes);
+    TRACK_FREE(pool->slots);
+    memset(pool, 0, sizeof(*pool));
+}
+
+// Copies 'length' characters plus a '\0' into the arena.
+static char* pool_store(StringPool_t *pool, const char *text, size_t length) {
+    PoolBlock_t *block = pool->blocks;
+    if (block == NULL || block->capacity - block->used < length + 1) {
+        // Start a new block (a bigger one, if this string alone needs it)
+        size_t capacity = (length + 1 > POOL_BLOCK_SIZE) ? length + 1 : POOL_BLOCK_SIZE;
+        PoolBlock_t *fresh = (PoolBlock_t*) TRACK_MALLOC(sizeof(PoolBlock_t) + capacity);
+        if (fresh == NULL) {
+            return NULL;
+        }
+        fresh->used = 0;
+        fresh->capacity = capacity;
+        fresh->next = pool->blocks;
+        pool->blocks = fresh;
+        block = fresh;
+    }
+    char *copy = block->data + block->used;
+    memcpy(copy, text, length);
+    copy[length] = '\0';
+    block->used += length + 1;
+    return copy;
+}
+
+// Doubles the hash table and puts every handle in its new slot.
+static int pool_grow_table(StringPool_t *pool) {
+    uint32_t newCount = pool->slotCount * 2;
+    StringHandle_t *newSlots = (StringHandle_t*) TRACK_CALLOC(newCount, sizeof(StringHandle_t));
+    if (newSlots == NULL) {
+        return -1;
+    }
+    for (StringHandle_t handle = 1; handle < pool->count; handle++) {
+        uint32_t slot = pool->hashes[handle] & (newCount - 1);
+        while (newSlots[slot] != 0) {
+            slot = (slot + 1) & (newCount - 1);
+        }
+        newSlots[slot] = handle;
+    }
+    TRACK_FREE(pool->slots);
+    pool->slots = newSlots;
+    pool->slotCount = newCount;
+    return 0;
+}
+
+// Returns the handle for 'text', adding it to the pool the first time.
+// The same text always gets the same handle. Returns 0 if out of memory.
+StringHandle_t string_pool_intern(StringPool_t *pool, const char *text) {
+    size_t length = strlen(text);
+    uint32_t hash = hash_string(text, length);
+
+    // Look for it: start at the hash's slot, walk forward until an empty slot
+    uint32_t mask = pool->slotCount - 1;
+    uint32_t slot = hash & mask;
+    while (pool->slots[slot] != 0) {
+        StringHandle_t handle = pool->slots[slot];
+        // Compare the hash first: strcmp only runs when it is very likely a match
+        if (pool->hashes[handle] == hash && strcmp(pool->strings[handle], text) == 0) {
+            return handle;
+        }
+        slot = (slot + 1) & mask;
+    }
+
+    // Not found: add it. First make sure the table stays at most half
+    // full, so searches stay short and always reach an empty slot.
+    if ((pool->count + 1) * 2 > pool->slotCount) {
+        if (pool_grow_table(pool) != 0) {
+            return 0; // A full table would make the search above loop forever
+        }
+        // The table changed: find the empty slot for this string again
+        mask = pool->slotCount - 1;
+        slot = hash & mask;
+        while (pool->slots[slot] != 0) {
+            slot = (slot + 1) & mask;
+        }
+    }
+    if (pool->count == pool->capacity) {
+        uint32_t newCapacity = pool->capacity * 2;
+        const char **strings = (const char**) TRACK_REALLOC(pool->strings, newCapacity * sizeof(const char*));
+        if (strings == NULL) {
+            return 0;
+        }
+        pool->strings = strings;
+        uint32_t *hashes = (uint32_t*) TRACK_REALLOC(pool->hashes, newCapacity * sizeof(uint32_t));
+        if (hashes == NULL) {
+            return 0;
+        }
+        pool->hashes = hashes;
+        pool->capacity = newCapacity;
+    }
+    char *copy = pool_store(pool, text, length);
+    if (copy == NULL) {
+        return 0;
+    }
+    StringHandle_t handle = pool->count++;
+    pool->strings[handle] = copy;
+    pool->hashes[handle] = hash;
+    pool->slots[slot] = handle;
+    return handle;
+}
+
+// The text for a handle (valid until string_pool_free)
+const char* string_pool_get(const StringPool_t *pool, StringHandle_t handle) {
+    return (handle < pool->count) ? pool->strings[handle] : "";
+}
+
+// Total memory the pool uses: arena blocks plus tables
+size_t string_pool_bytes(const StringPool_t *pool) {
+    size_t bytes = pool->capacity * (sizeof(const char*) + sizeof(uint32_t)) +
+                   pool->slotCount * sizeof(StringHandle_t);
+    for (const PoolBlock_t *block = pool->blocks; block != NULL; block = block->next) {
+        bytes += sizeof(PoolBlock_t) + block->capacity;
+    }
+    return bytes;
+}
+
+// --- The records, storing handles instead of char[50] ---
+
+typedef struct {
+    StringHandle_t name; // Handle into a StringPool_t
+    int id;
+    float gpa;
+} StudentInterned_t;
+
+typedef struct CarInterned_t {
+    StringHandle_t model; // Handle into a StringPool_t
+    int year;
+    int speed;
+    // The methods need the pool to turn the handle back into text
+    void (*printDetails)(const struct CarInterned_t *self, const StringPool_t *pool);
+    void (*accelerate)(struct CarInterned_t *self, int amount);
+} CarInterned_t;
+
+void car_interned_printDetails(const CarInterned_t *self, const StringPool_t *pool) {
+    printf("Car Model: %s, Year: %d, Speed: %d\n",
+           string_pool_get(pool, self->model), self->year, self->speed);
+}
+
+void car_interned_accelerate(CarInterned_t *self, int amount) {
+    self->speed += amount;
+}
+
+CarInterned_t createCarInterned(StringPool_t *pool, const char *model, int year) {
+    CarInterned_t newCar;
+    newCar.model = string_pool_intern(pool, model);
+    newCar.year = year;
+    newCar.speed = 0;
+    newCar.printDetails = &car_interned_printDetails;
+    newCar.accelerate = &car_interned_accelerate;
+    return newCar;
+}
+
+void level_18_string_pool() {
+    printf("\n--- Level 18: Interned Strings (A String Pool) ---\n");
+
+    printf("sizeof(struct Student) = %zu bytes, sizeof(StudentInterned_t) = %zu bytes\n",
+           sizeof(struct Student), sizeof(StudentInterned_t));
+    printf("sizeof(Car) = %zu bytes, sizeof(CarInterned_t) = %zu bytes\n",
+           sizeof(Car), sizeof(CarInterned_t));
+
+    StringPool_t pool;
+    if (string_pool_init(&pool) != 0) {
+        printf("Failed to allocate memory!\n");
+        return;
+    }
+
+    // --- 1. A Car "object" with an interned model (like Level 7) ---
+    CarInterned_t myCar = createCarInterned(&pool, "Tesla Model S", 2024);
+    CarInterned_t otherCar = createCarInterned(&pool, "Tesla Model S", 2023);
+    myCar.accelerate(&myCar, 50);
+    myCar.printDetails(&myCar, &pool);
+    printf("Same model? %s (handles %u and %u, no strcmp needed)\n",
+           myCar.model == otherCar.model ? "yes" : "no", myCar.model, otherCar.model);
+
+    // --- 2. Many students, few different names ---
+    size_t count = perf_size;
+    struct Student *students = (struct Student*) TRACK_MALLOC(count * sizeof(struct Student));
+    StudentInterned_t *interned = (StudentInterned_t*) TRACK_MALLOC(count * sizeof(StudentInterned_t));
+    if (students == NULL || interned == NULL) {
+        printf("Failed to allocate memory!\n");
+        TRACK_FREE(students);
+        TRACK_FREE(interned);
+        string_pool_free(&pool);
+        return;
+    }
+
+    static const char *firstNames[] = { "Ahmed", "Fatima", "Ali", "Sara", "Youssef", "Khadija", "Omar", "Salma" };
+    srand(18);
+    char name[50];
+    for (size_t i = 0; i < count; i++) {
+        // About 8 * 500 = 4000 different names
+        sprintf(name, "%s %d", firstNames[rand() % 8], rand() % 500);
+        strcpy(students[i].name, name);
+        students[i].id = (int) i;
+        students[i].gpa = (float)(rand() % 401) / 100.0f;
+    }
+
+    uint32_t entriesBefore = pool.count; // The pool already holds the car model
+    double start = perf_now_seconds();
+    for (size_t i = 0; i < count; i++) {
+        interned[i].name = string_pool_intern(&pool, students[i].name);
+        interned[i].id = students[i].id;
+        interned[i].gpa = students[i].gpa;
+    }
+    double internSeconds = perf_now_seconds() - start;
+
+    size_t plainBytes = count * sizeof(struct Student);
+    size_t internedBytes = count * sizeof(StudentInterned_t) + string_pool_bytes(&pool);
+    printf("%zu students, %u different names (interning took %.3f s)\n",
+           count, pool.count - entriesBefore, internSeconds);
+    printf("Memory: char[50] records %zu bytes, handles + pool %zu bytes (%.1f bytes saved per record)\n",
+           plainBytes, internedBytes, ((double) plainBytes - (double) internedBytes) / (double) count);
+
+    // --- 3. Comparing names: strcmp vs. handles ---
+    // Compare every student with another one further along the array
+    size_t step = count / 3 + 1;
+    start = perf_now_seconds();
+    size_t strcmpMatches = 0;
+    for (size_t i = 0; i < count; i++) {
+        size_t j = (i + step) % count;
+        if (strcmp(students[i].name, students[j].name) == 0) {
+            strcmpMatches++;
+        }
+    }
+    double strcmpSeconds = perf_now_seconds() - start;
+
+    start = perf_now_seconds();
+    size_t handleMatches = 0;
+    for (size_t i = 0; i < count; i++) {
+        size_t j = (i + step) % count;
+        if (interned[i].name == interned[j].name) {
+            handleMatches++;
+        }
+    }
+    double handleSeconds = perf_now_seconds() - start;
+
+    printf("Equal names with strcmp:  %zu in %.4f s\n", strcmpMatches, strcmpSeconds);
+    printf("Equal names with handles: %zu in %.4f s (%.1fx faster)\n",
+           handleMatches, handleSeconds, strcmpSeconds / handleSeconds);
+    printf("Student 0 is still readable: %s, ID %d\n",
+           string_pool_get(&pool, interned[0].name), interned[0].id);
+
+    TRACK_FREE(students);
+    TRACK_FREE(interned);
+    string_pool_free(&pool);
+}
+
+
+/* * =================================================================
+ * MAIN FUNCTION
+ * =================================================================
+ * argv[1] (optional): how many elements each level should use.
+ */
+int main(int argc, char *argv[]) {
+    printf("===========================================\n");
+    printf("Welcome to your C Language Performance Guide\n");
+    printf("===========================================\n");
+
+    if (argc > 1) {
+        long requested = strtol(argv[1], NULL, 10);
+        if (requested > 0) {
+            perf_size = (size_t) requested;
+        } else {
+            printf("Ignoring invalid size '%s'.\n", argv[1]);
+        }
+    }
+    printf("Working with %zu elements per level.\n", perf_size);
+
+    // (Compile with -DMEASURE_LEVELS to measure each whole level too)
+    RUN_LEVEL(level_12_persistent_list());
+    RUN_LEVEL(level_13_bulk_parsing());
+    RUN_LEVEL(level_14_integer_codecs());
+    RUN_LEVEL(level_15_hardware_counters());
+    RUN_LEVEL(level_16_parallel_scan());
+    RUN_LEVEL(level_17_batch_operations());
+    RUN_LEVEL(level_18_string_pool());
+
+    printf("\n===========================================\n");
+    printf("Performance Guide complete. End of program.\n");
+    printf("===========================================\n");
+
+    return 0;
+}
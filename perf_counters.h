@@ -0,0 +1,253 @@
+/**************************************************************
+ * Filename: perf_counters.h
+ * Description:
+ * A small "measure this piece of code" helper, shared by all the
+ * guide files. Wall time only tells you *that* code got slower;
+ * the CPU's hardware counters tell you *why*:
+ * - cycles and instructions (IPC = instructions per cycle; low IPC
+ *   means the CPU is mostly waiting),
+ * - cache misses (waiting for memory),
+ * - branch misses (the CPU guessed an 'if' wrong).
+ *
+ * On Linux the counters are read with the perf_event_open system call.
+ * They are opened as one *group*, so they all count during exactly the
+ * same time and their ratios (like IPC) are meaningful.
+ * If that is not possible (another OS, a virtual machine without
+ * counters, or /proc/sys/kernel/perf_event_paranoid is too strict),
+ * the report shows only the time. A counter that is missing while
+ * others work is shown as "n/a".
+ *
+ * The counters need the Linux kernel headers, so they are only used
+ * when asked for: with -DMEASURE_LEVELS, or in a file that does
+ * #define PERF_HARDWARE_COUNTERS before including this header
+ * (leran_performance.c does). Otherwise the header measures time only
+ * and needs nothing but the standard C library.
+ * They also need the syscall() function, which a strict standard mode
+ * like -std=c99 hides; there the header measures time only as well
+ * (use the default gnu mode, or add -D_GNU_SOURCE, to get them back).
+ *
+ * How to use:
+ * 1. Around any piece of code:
+ *        PerfRegion_t region;
+ *        perf_region_begin(&region, "sum array");
+ *        ... the code ...
+ *        perf_region_end(&region);
+ *        perf_region_report(&region, count); // count: elements processed (0 = skip per-element numbers)
+ * 2. Around one call:  PERF_MEASURE("level 4", 0, level_4_complex_data());
+ * 3. Around every level in main(): compile with -DMEASURE_LEVELS,
+ *    e.g. gcc -DMEASURE_LEVELS leran.c -o leran
+ **************************************************************/
+
+#ifndef PERF_COUNTERS_H
+#define PERF_COUNTERS_H
+
+#include <stdio.h>
+#include <string.h> // For memset
+#include <stdint.h> // For uint64_t
+#include <time.h> // For clock_gettime / clock
+
+// gcc defines __STRICT_ANSI__ for -std=c99 / -std=c11; then <unistd.h>
+// only declares syscall() if _GNU_SOURCE or _DEFAULT_SOURCE is defined.
+#if defined(__linux__) && (defined(MEASURE_LEVELS) || defined(PERF_HARDWARE_COUNTERS)) && \
+    (!defined(__STRICT_ANSI__) || defined(_GNU_SOURCE) || defined(_DEFAULT_SOURCE))
+#define PERF_HAVE_COUNTERS 1
+#endif
+
+#ifdef PERF_HAVE_COUNTERS
+#include <unistd.h> // For syscall, read, close
+#include <sys/ioctl.h> // For ioctl
+#include <sys/syscall.h> // For __NR_perf_event_open
+#include <linux/perf_event.h> // For struct perf_event_attr
+#endif
+
+enum PerfCounter {
+    PERF_CYCLES,
+    PERF_INSTRUCTIONS,
+    PERF_CACHE_MISSES,
+    PERF_BRANCH_MISSES,
+    PERF_COUNTER_COUNT // Not a counter: how many there are
+};
+
+typedef struct {
+    const char *name;
+    int fds[PERF_COUNTER_COUNT]; // One file descriptor per counter (-1 = not available)
+    uint64_t values[PERF_COUNTER_COUNT];
+    int valid[PERF_COUNTER_COUNT]; // 1 if values[i] was read successfully
+    double startSeconds;
+    double seconds; // Wall time between begin and end
+} PerfRegion_t;
+
+// Returns the current time in seconds (only differences are meaningful).
+// CLOCK_MONOTONIC never jumps backwards, unlike the wall clock.
+static inline double perf_now_seconds() {
+#if defined(CLOCK_MONOTONIC)
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec / 1e9;
+#else
+    return (double)clock() / CLOCKS_PER_SEC; // Portable, but less precise
+#endif
+}
+
+#ifdef PERF_HAVE_COUNTERS
+// What one read() of the group leader returns: how long the group was
+// enabled and really counting, then one value per counter in the group
+// (in the order they were opened). If the CPU has too few counters,
+// Linux takes turns ("multiplexing") and we scale up. The whole group
+// is always switched in and out together.
+typedef struct {
+    uint64_t count; // Number of values that follow
+    uint64_t timeEnabled;
+    uint64_t timeRunning;
+    uint64_t values[PERF_COUNTER_COUNT];
+} PerfGroupReading_t;
+
+// 'leader' is -1 for the first counter (it becomes the group leader),
+// and the leader's file descriptor for the others.
+static inline int perf_open_counter(uint64_t config, int leader) {
+    struct perf_event_attr attr;
+    memset(&attr, 0, sizeof(attr));
+    attr.size = sizeof(attr);
+    attr.type = PERF_TYPE_HARDWARE;
+    attr.config = config;
+    attr.disabled = (leader == -1); // The leader starts stopped; perf_region_begin switches the group on
+    attr.exclude_kernel = 1; // Only count our own code, not the OS
+    attr.exclude_hv = 1;
+    attr.read_format = PERF_FORMAT_GROUP | PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+
+    // pid 0 = this process, cpu -1 = any CPU. There is no glibc wrapper.
+    return (int) syscall(__NR_perf_event_open, &attr, 0, -1, leader, 0);
+}
+#endif
+
+static inline void perf_region_begin(PerfRegion_t *region, const char *name) {
+    memset(region, 0, sizeof(*region));
+    region->name = name;
+
+#ifdef PERF_HAVE_COUNTERS
+    static const uint64_t configs[PERF_COUNTER_COUNT] = {
+        PERF_COUNT_HW_CPU_CYCLES,
+        PERF_COUNT_HW_INSTRUCTIONS,
+        PERF_COUNT_HW_CACHE_MISSES,
+        PERF_COUNT_HW_BRANCH_MISSES
+    };
+    // Cycles is the group leader; without it there is no group at all
+    int leader = perf_open_counter(configs[PERF_CYCLES], -1);
+    region->fds[PERF_CYCLES] = leader;
+    for (int i = 0; i < PERF_COUNTER_COUNT; i++) {
+        if (i != PERF_CYCLES) {
+            region->fds[i] = (leader >= 0) ? perf_open_counter(configs[i], leader) : -1;
+        }
+    }
+    // Start the whole group at once, right before the code
+    if (leader >= 0) {
+        ioctl(leader, PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+        ioctl(leader, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+    }
+#else
+    for (int i = 0; i < PERF_COUNTER_COUNT; i++) {
+        region->fds[i] = -1;
+    }
+#endif
+    region->startSeconds = perf_now_seconds();
+}
+
+static inline void perf_region_end(PerfRegion_t *region) {
+    region->seconds = perf_now_seconds() - region->startSeconds;
+
+#ifdef PERF_HAVE_COUNTERS
+    int leader = region->fds[PERF_CYCLES];
+    if (leader < 0) {
+        return;
+    }
+    ioctl(leader, PERF_EVENT_IOC_DISABLE, PERF_IOC_FLAG_GROUP);
+
+    // One read gives every counter of the group, from the same time window
+    PerfGroupReading_t reading;
+    ssize_t bytes = read(leader, &reading, sizeof(reading));
+    if (bytes >= (ssize_t)(3 * sizeof(uint64_t)) && reading.timeRunning > 0 &&
+        reading.count >= 1 && reading.count <= PERF_COUNTER_COUNT &&
+        (size_t)bytes == (3 + reading.count) * sizeof(uint64_t)) {
+        double scale = (double)reading.timeEnabled / (double)reading.timeRunning;
+        // The values come in the order the counters were opened:
+        // the leader first, then the others that opened successfully
+        uint64_t next = 0;
+        region->values[PERF_CYCLES] = (uint64_t)((double)reading.values[next++] * scale);
+        region->valid[PERF_CYCLES] = 1;
+        for (int i = 0; i < PERF_COUNTER_COUNT && next < reading.count; i++) {
+            if (i != PERF_CYCLES && region->fds[i] >= 0) {
+                region->values[i] = (uint64_t)((double)reading.values[next++] * scale);
+                region->valid[i] = 1;
+            }
+        }
+    }
+    for (int i = 0; i < PERF_COUNTER_COUNT; i++) {
+        if (region->fds[i] >= 0) {
+            close(region->fds[i]);
+            region->fds[i] = -1;
+        }
+    }
+#endif
+}
+
+// Prints one line for the region, plus a second line with
+// per-element numbers if 'elements' is not 0.
+static inline void perf_region_report(const PerfRegion_t *region, size_t elements) {
+    static const char *labels[PERF_COUNTER_COUNT] = {
+        "cycles", "instructions", "cache-misses", "branch-misses"
+    };
+    static int warned = 0;
+
+    int anyValid = 0;
+    for (int i = 0; i < PERF_COUNTER_COUNT; i++) {
+        anyValid = anyValid || region->valid[i];
+    }
+
+    printf("[perf] %s: %.6f s", region->name, region->seconds);
+    for (int i = 0; i < PERF_COUNTER_COUNT && anyValid; i++) {
+        if (region->valid[i]) {
+            printf(" | %s %llu", labels[i], (unsigned long long) region->values[i]);
+        } else {
+            printf(" | %s n/a", labels[i]);
+        }
+    }
+    if (region->valid[PERF_CYCLES] && region->valid[PERF_INSTRUCTIONS] && region->values[PERF_CYCLES] > 0) {
+        printf(" | IPC %.2f", (double)region->values[PERF_INSTRUCTIONS] / (double)region->values[PERF_CYCLES]);
+    }
+    printf("\n");
+
+    if (elements > 0) {
+        printf("[perf]   per element: %.2f ns", region->seconds * 1e9 / (double)elements);
+        for (int i = 0; i < PERF_COUNTER_COUNT; i++) {
+            if (region->valid[i]) {
+                printf(" | %s %.3f", labels[i], (double)region->values[i] / (double)elements);
+            }
+        }
+        printf("\n");
+    }
+
+    if (!anyValid && !warned) {
+        printf("[perf]   (hardware counters are not available here, showing time only)\n");
+        warned = 1;
+    }
+}
+
+// Measures one statement (usually a function call) and prints the report.
+#define PERF_MEASURE(name, elements, statement) \
+    do { \
+        PerfRegion_t perfRegion_; \
+        perf_region_begin(&perfRegion_, (name)); \
+        statement; \
+        perf_region_end(&perfRegion_); \
+        perf_region_report(&perfRegion_, (elements)); \
+    } while (0)
+
+// main() runs every level through RUN_LEVEL. Normally it is just the
+// call; with -DMEASURE_LEVELS each level is measured and reported.
+#ifdef MEASURE_LEVELS
+#define RUN_LEVEL(call) PERF_MEASURE(#call, 0, call)
+#else
+#define RUN_LEVEL(call) call
+#endif
+
+#endif // PERF_COUNTERS_H
@@ -0,0 +1,320 @@
+/**************************************************************
+ * Filename: track_alloc.h
+ * Description:
+ * An allocation tracker shared by all the guide files. Every
+ * malloc/calloc/realloc/free in the guide goes through the
+ * TRACK_MALLOC / TRACK_CALLOC / TRACK_REALLOC / TRACK_FREE macros.
+ *
+ * - Normally (no flag) the macros *are* malloc, calloc, realloc and
+ *   free. The tracker does not exist and costs nothing.
+ * - Compiled with -DTRACK_ALLOC, every allocation is recorded:
+ *   live bytes, peak bytes, number of allocations per call site
+ *   (file:line), and a histogram of allocation sizes. When the
+ *   program exits, a report is printed to stderr, including every
+ *   call site that still has memory that was never freed (a leak).
+ *   realloc is not a new allocation: the block stays counted at the
+ *   call site that first allocated it, with its new size.
+ *
+ * How to use:
+ *   gcc -DTRACK_ALLOC leran.c -o leran
+ *   ./leran            (the report appears at the end)
+ **************************************************************/
+
+#ifndef TRACK_ALLOC_H
+#define TRACK_ALLOC_H
+
+#include <stdlib.h> // For malloc, calloc, realloc, free
+
+#ifndef TRACK_ALLOC
+
+// --- Tracking OFF: plain calls, nothing else ---
+#define TRACK_MALLOC(size) malloc(size)
+#define TRACK_CALLOC(count, size) calloc((count), (size))
+#define TRACK_REALLOC(ptr, size) realloc((ptr), (size))
+#define TRACK_FREE(ptr) free(ptr)
+
+#else
+
+// --- Tracking ON ---
+#include <stdio.h>
+#include <string.h> // For memset, strcmp
+
+// __FILE__ and __LINE__ are filled in by the preprocessor (Level 9)
+// at each place the macro is used, so we know *who* allocated.
+#define TRACK_MALLOC(size) track_malloc((size), __FILE__, __LINE__)
+#define TRACK_CALLOC(count, size) track_calloc((count), (size), __FILE__, __LINE__)
+#define TRACK_REALLOC(ptr, size) track_realloc((ptr), (size), __FILE__, __LINE__)
+#define TRACK_FREE(ptr) track_free((ptr), __FILE__, __LINE__)
+
+#define TRACK_MAX_SITES 256 // Different file:line places we can tell apart
+#define TRACK_HISTOGRAM_BUCKETS 33 // Sizes by power of two: 0, 1, 2-3, 4-7, ... 2^31+
+#define TRACK_MAGIC 0x7A110C8Du // Marks a block as "ours and still allocated"
+
+// Each block gets a small header in front of the memory we hand out.
+// The union with the "biggest" basic types makes the header's size a
+// multiple of their alignment, so the user's memory is as well aligned
+// as plain malloc would make it. (C11's max_align_t says the same in
+// one word, but the guide also builds as C99.)
+typedef union {
+    struct {
+        size_t size; // Bytes the caller asked for
+        unsigned int site; // Index into track_sites
+        unsigned int magic; // TRACK_MAGIC while allocated
+    } info;
+    long double alignLongDouble;
+    long long alignLongLong;
+    void *alignPointer;
+    void (*alignFunction)(void);
+} TrackHeader_t;
+
+typedef struct {
+    const char *file; // NULL = unused slot
+    int line;
+    size_t allocations; // How many times this site allocated
+    size_t bytes; // Total bytes ever allocated here
+    size_t liveBlocks; // Blocks from here not freed yet
+    size_t liveBytes;
+} TrackSite_t;
+
+static TrackSite_t track_sites[TRACK_MAX_SITES];
+static size_t track_histogram[TRACK_HISTOGRAM_BUCKETS];
+static size_t track_live_bytes = 0;
+static size_t track_peak_bytes = 0;
+static size_t track_total_allocations = 0;
+static int track_report_registered = 0;
+
+// A tiny lock, so several threads can allocate at the same time.
+#if defined(__GNUC__)
+static volatile int track_lock_flag = 0;
+#define TRACK_LOCK() while (__sync_lock_test_and_set(&track_lock_flag, 1)) { }
+#define TRACK_UNLOCK() __sync_lock_release(&track_lock_flag)
+#else
+#define TRACK_LOCK()
+#define TRACK_UNLOCK()
+#endif
+
+static void track_report();
+
+// Finds (or creates) the slot for a file:line. Must hold the lock.
+// __FILE__ is the same string for one file, so comparing the
+// pointer is enough.
+static unsigned int track_site_index(const char *file, int line) {
+    unsigned int slot = ((unsigned int) line * 31u + (unsigned int)((size_t) file >> 4)) % TRACK_MAX_SITES;
+    for (unsigned int tries = 0; tries < TRACK_MAX_SITES; tries++) {
+        TrackSite_t *site = &track_sites[slot];
+        if (site->file == NULL) {
+            site->file = file;
+            site->line = line;
+            return slot;
+        }
+        if (site->file == file && site->line == line) {
+            return slot;
+        }
+        slot = (slot + 1) % TRACK_MAX_SITES;
+    }
+    return 0; // Table full: count it with whatever is in slot 0
+}
+
+static int track_bucket(size_t size) {
+    int bucket = 0;
+    while (size > 0 && bucket < TRACK_HISTOGRAM_BUCKETS - 1) {
+        size >>= 1;
+        bucket++;
+    }
+    return bucket;
+}
+
+// Adds a block's bytes to the live totals of its site. Must hold the lock.
+static void track_add_live(unsigned int index, size_t size) {
+    TrackSite_t *site = &track_sites[index];
+    site->liveBlocks++;
+    site->liveBytes += size;
+    track_live_bytes += size;
+    if (track_live_bytes > track_peak_bytes) {
+        track_peak_bytes = track_live_bytes;
+    }
+}
+
+// Fills in the header and returns the pointer the caller will use.
+static void* track_mark_block(TrackHeader_t *header, size_t size, unsigned int index) {
+    header->info.size = size;
+    header->info.site = index;
+    header->info.magic = TRACK_MAGIC;
+    return header + 1; // The user's memory starts right after the header
+}
+
+// Records a new block (malloc/calloc) made at file:line.
+static void* track_register(TrackHeader_t *header, size_t size, const char *file, int line) {
+    TRACK_LOCK();
+    unsigned int index = track_site_index(file, line);
+    TrackSite_t *site = &track_sites[index];
+    site->allocations++;
+    site->bytes += size;
+    track_histogram[track_bucket(size)]++;
+    track_total_allocations++;
+    track_add_live(index, size);
+    if (!track_report_registered) {
+        track_report_registered = 1;
+        atexit(track_report); // Print the report when the program ends
+    }
+    TRACK_UNLOCK();
+    return track_mark_block(header, size, index);
+}
+
+// Makes a block live again after realloc, with its (new) size. It is
+// not a new allocation and it stays with the site at 'index'.
+static void* track_reregister(TrackHeader_t *header, size_t size, unsigned int index) {
+    TRACK_LOCK();
+    track_add_live(index, size);
+    TRACK_UNLOCK();
+    return track_mark_block(header, size, index);
+}
+
+// Finds the header of a block and forgets the block.
+// Returns NULL (after printing a warning) if the pointer is not ours.
+static TrackHeader_t* track_unregister(void *ptr, const char *file, int line) {
+    TrackHeader_t *header = (TrackHeader_t*) ptr - 1;
+    if (header->info.magic != TRACK_MAGIC) {
+        fprintf(stderr, "track_alloc: %s:%d frees a pointer that is not allocated (double free?)\n", file, line);
+        return NULL;
+    }
+    header->info.magic = 0; // So a second free of the same block is (usually) caught
+
+    TRACK_LOCK();
+    TrackSite_t *site = &track_sites[header->info.site];
+    site->liveBlocks--;
+    site->liveBytes -= header->info.size;
+    track_live_bytes -= header->info.size;
+    TRACK_UNLOCK();
+    return header;
+}
+
+static inline void* track_malloc(size_t size, const char *file, int line) {
+    if (size > (size_t)-1 - sizeof(TrackHeader_t)) {
+        return NULL;
+    }
+    TrackHeader_t *header = (TrackHeader_t*) malloc(sizeof(TrackHeader_t) + size);
+    if (header == NULL) {
+        return NULL;
+    }
+    return track_register(header, size, file, line);
+}
+
+static inline void* track_calloc(size_t count, size_t size, const char *file, int line) {
+    if (size != 0 && count > ((size_t)-1 - sizeof(TrackHeader_t)) / size) {
+        return NULL; // count * size would overflow
+    }
+    void *ptr = track_malloc(count * size, file, line);
+    if (ptr != NULL) {
+        memset(ptr, 0, count * size);
+    }
+    return ptr;
+}
+
+static inline void track_free(void *ptr, const char *file, int line) {
+    if (ptr == NULL) {
+        return; // free(NULL) does nothing
+    }
+    TrackHeader_t *header = track_unregister(ptr, file, line);
+    if (header != NULL) {
+        free(header);
+    }
+}
+
+static inline void* track_realloc(void *ptr, size_t size, const char *file, int line) {
+    if (ptr == NULL) {
+        return track_malloc(size, file, line);
+    }
+    if (size == 0) {
+        track_free(ptr, file, line);
+        return NULL;
+    }
+    if (size > (size_t)-1 - sizeof(TrackHeader_t)) {
+        return NULL;
+    }
+    TrackHeader_t *header = track_unregister(ptr, file, line);
+    if (header == NULL) {
+        return NULL;
+    }
+    // Read these now: after a successful realloc, 'header' is gone
+    unsigned int site = header->info.site;
+    size_t oldSize = header->info.size;
+    TrackHeader_t *moved = (TrackHeader_t*) realloc(header, sizeof(TrackHeader_t) + size);
+    if (moved == NULL) {
+        // Like realloc: the old block is still valid, so it becomes live again
+        track_reregister(header, oldSize, site);
+        return NULL;
+    }
+    return track_reregister(moved, size, site);
+}
+
+// Orders call sites by file name, then line, for the report
+static int track_compare_sites(const void *a, const void *b) {
+    const TrackSite_t *siteA = (const TrackSite_t*) a;
+    const TrackSite_t *siteB = (const TrackSite_t*) b;
+    int byFile = strcmp(siteA->file, siteB->file);
+    return (byFile != 0) ? byFile : siteA->line - siteB->line;
+}
+
+static void track_report() {
+    TRACK_LOCK();
+    // Gather the used slots (the table is in hash order) and sort them
+    TrackSite_t sorted[TRACK_MAX_SITES];
+    int siteCount = 0;
+    for (int i = 0; i < TRACK_MAX_SITES; i++) {
+        if (track_sites[i].file != NULL) {
+            sorted[siteCount++] = track_sites[i];
+        }
+    }
+    qsort(sorted, (size_t) siteCount, sizeof(TrackSite_t), track_compare_sites);
+
+    fprintf(stderr, "\n===== track_alloc report =====\n");
+    fprintf(stderr, "Allocations: %zu, peak: %zu bytes, still allocated: %zu bytes\n",
+            track_total_allocations, track_peak_bytes, track_live_bytes);
+
+    fprintf(stderr, "Per call site (allocations / bytes / still allocated):\n");
+    size_t leakedBlocks = 0;
+    for (int i = 0; i < siteCount; i++) {
+        const TrackSite_t *site = &sorted[i];
+        fprintf(stderr, "  %s:%d: %zu / %zu / %zu\n",
+                site->file, site->line, site->allocations, site->bytes, site->liveBytes);
+        leakedBlocks += site->liveBlocks;
+    }
+
+    fprintf(stderr, "Size histogram:\n");
+    for (int bucket = 0; bucket < TRACK_HISTOGRAM_BUCKETS; bucket++) {
+        if (track_histogram[bucket] == 0) {
+            continue;
+        }
+        if (bucket == 0) {
+            fprintf(stderr, "  0 bytes: %zu\n", track_histogram[bucket]);
+        } else if (bucket == TRACK_HISTOGRAM_BUCKETS - 1) {
+            // The last bucket has no upper end: it holds everything from 2^31 up
+            size_t low = (size_t)1 << (bucket - 1);
+            fprintf(stderr, "  %zu+ bytes: %zu\n", low, track_histogram[bucket]);
+        } else {
+            // Bucket b holds sizes from 2^(b-1) to 2^b - 1
+            size_t low = (size_t)1 << (bucket - 1);
+            fprintf(stderr, "  %zu-%zu bytes: %zu\n", low, low * 2 - 1, track_histogram[bucket]);
+        }
+    }
+
+    if (leakedBlocks == 0) {
+        fprintf(stderr, "No leaks.\n");
+    } else {
+        fprintf(stderr, "LEAKS: %zu blocks, %zu bytes never freed:\n", leakedBlocks, track_live_bytes);
+        for (int i = 0; i < siteCount; i++) {
+            const TrackSite_t *site = &sorted[i];
+            if (site->liveBlocks > 0) {
+                fprintf(stderr, "  LEAK %s:%d: %zu blocks, %zu bytes\n",
+                        site->file, site->line, site->liveBlocks, site->liveBytes);
+            }
+        }
+    }
+    fprintf(stderr, "==============================\n");
+    TRACK_UNLOCK();
+}
+
+#endif // TRACK_ALLOC
+
+#endif // TRACK_ALLOC_H